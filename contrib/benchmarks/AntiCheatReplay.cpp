@@ -0,0 +1,314 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Replays a movement record written by the server (Custom.AntiCheat.RecordFile) through the anticheat checks,
+// the same way CPlayer::ValidateMovement runs them, and reports the validation cost and every event whose
+// detections differ from the recorded ones.
+//
+// usage: anticheat_replay <record file> [passes] [checks mask]
+//
+// The mask selects the checks by AntiCheatFieldOffsets bit and must match the checks enabled on the server
+// that wrote the record. It defaults to all but tptoplane, which needs map data, and test, which only prints.
+// Update ticks are not recorded, the time check is fed the time between the records of a player instead.
+
+#include "Custom/AntiCheat/AntiCheat.h"
+#include "Custom/AntiCheat/AntiCheat_speed.h"
+#include "Custom/AntiCheat/AntiCheat_teleport.h"
+#include "Custom/AntiCheat/AntiCheat_fly.h"
+#include "Custom/AntiCheat/AntiCheat_jump.h"
+#include "Custom/AntiCheat/AntiCheat_gravity.h"
+#include "Custom/AntiCheat/AntiCheat_waterwalking.h"
+#include "Custom/AntiCheat/AntiCheat_wallclimb.h"
+#include "Custom/AntiCheat/AntiCheat_walljump.h"
+#include "Custom/AntiCheat/AntiCheat_tptoplane.h"
+#include "Custom/AntiCheat/AntiCheat_nofall.h"
+#include "Custom/AntiCheat/AntiCheat_time.h"
+#include "Custom/AntiCheat/AntiCheat_test.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct Record
+    {
+        char type;
+        uint32 now;
+        uint32 guid;
+        uint32 run;                                 // the file is appended to, guids may repeat across server runs
+        uint32 line;
+        AntiCheatEvent event;
+        unsigned long detected;
+    };
+
+    bool ReadRecord(std::string const& text, Record& record)
+    {
+        std::istringstream in(text);
+        in >> record.type >> record.now >> record.guid;
+
+        AntiCheatEvent& event = record.event;
+
+        switch (record.type)
+        {
+            case 'M':
+            {
+                MovementInfo moveInfo;
+                MovementInfo::JumpInfo jump;
+                uint32 opcode, flags, time, acTime, fallTime;
+                uint32 canFly, waterWalk, inWater, featherFall;
+                float x, y, z, o, tx, ty, tz;
+
+                event.type = ANTICHEAT_EVENT_MOVEMENT;
+                in >> event.state.mapId >> opcode >> flags >> time >> acTime >> x >> y >> z >> o >> tx >> ty >> tz >> fallTime
+                   >> jump.velocity >> jump.sinAngle >> jump.cosAngle >> jump.xyspeed
+                   >> canFly >> waterWalk >> inWater >> featherFall >> event.state.latency;
+                for (float& speed : event.state.speeds)
+                    in >> speed;
+                in >> record.detected;
+
+                moveInfo.SetMovementFlags(MovementFlags(flags));
+                moveInfo.UpdateTime(time);
+                moveInfo.SetACTime(acTime);
+                moveInfo.ChangePosition(x, y, z, o);
+                moveInfo.SetTransportData(ObjectGuid(), tx, ty, tz, 0.f, 0);
+                moveInfo.SetFallTime(fallTime);
+                moveInfo.SetJumpInfo(jump);
+
+                event.opcode = Opcodes(opcode);
+                event.mapId = event.state.mapId;
+                event.moveInfo = std::make_shared<MovementInfo>(moveInfo);
+                event.state.x = x;
+                event.state.y = y;
+                event.state.z = z;
+                event.state.alive = true;
+                event.state.canFly = canFly != 0;
+                event.state.waterWalk = waterWalk != 0;
+                event.state.inWater = inWater != 0;
+                event.state.featherFall = featherFall != 0;
+                break;
+            }
+            case 'R':
+            case 'T':
+                event.type = record.type == 'R' ? ANTICHEAT_EVENT_RELOCATE : ANTICHEAT_EVENT_TELEPORT;
+                in >> event.mapId >> event.x >> event.y >> event.z >> event.o;
+                break;
+            case 'K':
+                event.type = ANTICHEAT_EVENT_KNOCKBACK;
+                in >> event.mapId >> event.angle >> event.horizontalSpeed >> event.verticalSpeed;
+                break;
+            default:
+                return false;
+        }
+
+        return !in.fail();
+    }
+
+    // Stands in for the player, the side effects of the detections are only counted
+    class ReplayPlayer : public AntiCheatActions
+    {
+    public:
+        explicit ReplayPlayer(unsigned long checks)
+        {
+            if (checks & (1ul << CHEAT_SPEED))
+                m_checks.emplace_back(new AntiCheat_speed(this));
+            if (checks & (1ul << CHEAT_TELEPORT))
+                m_checks.emplace_back(new AntiCheat_teleport(this));
+            if (checks & (1ul << CHEAT_FLY))
+                m_checks.emplace_back(new AntiCheat_fly(this));
+            if (checks & (1ul << CHEAT_JUMP))
+                m_checks.emplace_back(new AntiCheat_jump(this));
+            if (checks & (1ul << CHEAT_GRAVITY))
+                m_checks.emplace_back(new AntiCheat_gravity(this));
+            if (checks & (1ul << CHEAT_WATERWALK))
+                m_checks.emplace_back(new AntiCheat_waterwalking(this));
+            if (checks & (1ul << CHEAT_WALLCLIMB))
+                m_checks.emplace_back(new AntiCheat_wallclimb(this));
+            if (checks & (1ul << CHEAT_WALLJUMP))
+                m_checks.emplace_back(new AntiCheat_walljump(this));
+            if (checks & (1ul << CHEAT_TPTOPLANE))
+                m_checks.emplace_back(new AntiCheat_tptoplane(this));
+            if (checks & (1ul << CHEAT_NOFALL))
+                m_checks.emplace_back(new AntiCheat_nofall(this));
+            if (checks & (1ul << CHEAT_TIME))
+                m_checks.emplace_back(new AntiCheat_time(this));
+            if (checks & (1ul << CHEAT_TEST))
+                m_checks.emplace_back(new AntiCheat_test(this));
+        }
+
+        bool ShowCheatDetails() const override { return false; }
+        std::ostream& GetBoxChat() override { return m_boxChat; }
+        void TeleportBack(uint32 /*mapId*/, Position const* /*pos*/) override { ++teleports; }
+        void DisableFly() override { ++disables; }
+        void DisableWaterWalk() override { ++disables; }
+        float GetStaticHeight(float /*x*/, float /*y*/, float z) const override { return z; }
+        void KillFallToVoid() override { ++kills; }
+
+        AntiCheatFields Validate(Record const& record)
+        {
+            AntiCheatEvent const& event = record.event;
+            AntiCheatFields cheatFields;
+            AntiCheatFields detectedFields;
+
+            if (m_lastNow && record.now != m_lastNow)
+                for (auto& i : m_checks)
+                    i->HandleUpdate(record.now - m_lastNow);
+            m_lastNow = record.now;
+
+            // only movement records carry the player state, relocation is only recorded on taxi flights
+            if (event.type == ANTICHEAT_EVENT_MOVEMENT)
+                m_state = event.state;
+            m_state.taxiFlying = event.type == ANTICHEAT_EVENT_RELOCATE;
+
+            for (auto& i : m_checks)
+                i->SetPlayerState(m_state);
+
+            switch (event.type)
+            {
+                case ANTICHEAT_EVENT_MOVEMENT:
+                    for (auto& i : m_checks)
+                        if (i->HandleMovement(event.moveInfo, event.opcode, cheatFields))
+                            detectedFields.set(i->GetCheatType());
+
+                    detectedFields |= cheatFields;
+                    break;
+                case ANTICHEAT_EVENT_RELOCATE:
+                    for (auto& i : m_checks)
+                        i->HandleRelocate(event.x, event.y, event.z, event.o);
+                    break;
+                case ANTICHEAT_EVENT_TELEPORT:
+                    for (auto& i : m_checks)
+                        i->HandleTeleport(event.mapId, event.x, event.y, event.z, event.o);
+                    break;
+                case ANTICHEAT_EVENT_KNOCKBACK:
+                    for (auto& i : m_checks)
+                        i->HandleKnockBack(event.angle, event.horizontalSpeed, event.verticalSpeed);
+                    break;
+            }
+
+            m_boxChat.str("");
+            return detectedFields;
+        }
+
+        uint32 teleports = 0;
+        uint32 disables = 0;
+        uint32 kills = 0;
+
+    private:
+        std::vector<std::unique_ptr<AntiCheat>> m_checks;
+        std::ostringstream m_boxChat;
+        AntiCheatPlayerState m_state;
+        uint32 m_lastNow = 0;
+    };
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        printf("usage: %s <record file> [passes] [checks mask]\n", argv[0]);
+        return 1;
+    }
+
+    int passes = argc > 2 ? atoi(argv[2]) : 1;
+    unsigned long checks = argc > 3 ? strtoul(argv[3], nullptr, 0) :
+        ((1ul << CHEAT_MAX) - 1) & ~(1ul << CHEAT_NONE) & ~(1ul << CHEAT_TPTOPLANE) & ~(1ul << CHEAT_TEST);
+
+    FILE* file = fopen(argv[1], "r");
+    if (!file)
+    {
+        printf("can't open %s\n", argv[1]);
+        return 1;
+    }
+
+    std::vector<Record> records;
+    char text[1024];
+    uint32 line = 0;
+    uint32 run = 0;
+    while (fgets(text, sizeof(text), file))
+    {
+        ++line;
+        if (text[0] == '#')
+            ++run;
+        if (text[0] == '#' || text[0] == '\n')
+            continue;
+
+        Record record{ 0, 0, 0, run, line, AntiCheatEvent(ANTICHEAT_EVENT_MOVEMENT), 0 };
+        if (ReadRecord(text, record))
+            records.push_back(std::move(record));
+        else
+            printf("line %u: unreadable record skipped\n", line);
+    }
+    fclose(file);
+
+    uint32 movements = 0;
+    uint32 mismatches = 0;
+    uint32 teleports = 0;
+    uint32 disables = 0;
+    uint32 kills = 0;
+    std::chrono::steady_clock::duration validation{};
+
+    for (int pass = 0; pass < passes; ++pass)
+    {
+        std::map<uint64, std::unique_ptr<ReplayPlayer>> players;
+
+        for (Record const& record : records)
+        {
+            std::unique_ptr<ReplayPlayer>& player = players[(uint64(record.run) << 32) | record.guid];
+            if (!player)
+                player.reset(new ReplayPlayer(checks));
+
+            auto start = std::chrono::steady_clock::now();
+            AntiCheatFields detected = player->Validate(record);
+            validation += std::chrono::steady_clock::now() - start;
+
+            if (record.event.type != ANTICHEAT_EVENT_MOVEMENT || pass > 0)
+                continue;
+
+            ++movements;
+            if ((detected.to_ulong() & checks) != (record.detected & checks))
+            {
+                ++mismatches;
+                printf("line %u: guid %u detected %lx, recorded %lx\n", record.line, record.guid,
+                    detected.to_ulong() & checks, record.detected & checks);
+            }
+        }
+
+        if (pass == 0)
+            for (auto const& player : players)
+            {
+                teleports += player.second->teleports;
+                disables += player.second->disables;
+                kills += player.second->kills;
+            }
+    }
+
+    long long us = std::chrono::duration_cast<std::chrono::microseconds>(validation).count();
+    printf("records: %zu, movements: %u, checks mask: %lx\n", records.size(), movements, checks);
+    printf("teleports back: %u, fly/water walk removed: %u, killed: %u\n", teleports, disables, kills);
+    printf("validation: %lld us for %d passes, %.1f ns per record\n", us, passes,
+        records.empty() || passes <= 0 ? 0.0 : us * 1000.0 / (double(records.size()) * passes));
+    printf("detections differing from the record: %u\n", mismatches);
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Proc event dispatch through AuraProcIndex against the walk over all aura holders it replaced. Units carry
+// many auras of which only a few can proc (talents, enchants, trinkets), like players in a fight; every
+// event reaches the proc check of each holder whose flags match, and both sides must trigger the same holders.
+// The proc check itself is a stand in for IsTriggeredAtSpellProcEvent.
+
+#include "Spells/AuraProcIndex.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Holder
+    {
+        uint32 id;
+        uint32 procFlags;
+        uint32 schoolMask;
+        bool ready;
+
+        uint32 GetId() const { return id; }
+        uint32 GetProcFlags() const { return procFlags; }
+    };
+
+    struct Unit
+    {
+        std::multimap<uint32, Holder*> holders;             // Unit::m_spellAuraHolders
+        AuraProcIndex<Holder> procHolders;
+    };
+
+    struct Event
+    {
+        uint32 unit;
+        uint32 procFlags;
+        uint32 schoolMask;
+    };
+
+    bool IsTriggered(Holder const* holder, Event const& event)
+    {
+        if (!(holder->procFlags & event.procFlags))
+            return false;
+        return !holder->schoolMask || (holder->schoolMask & event.schoolMask);
+    }
+
+    template<class Dispatch>
+    double Run(std::vector<Event> const& events, uint64& triggered, Dispatch dispatch)
+    {
+        triggered = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (Event const& event : events)
+            triggered += dispatch(event);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32 unitCount = argc > 1 ? uint32(atoi(argv[1])) : 1000;
+    uint32 aurasPerUnit = argc > 2 ? uint32(atoi(argv[2])) : 30;
+    uint32 procAurasPerUnit = argc > 3 ? uint32(atoi(argv[3])) : 3;
+    uint32 eventCount = argc > 4 ? uint32(atoi(argv[4])) : 2000000;
+
+    printf("%u units, %u auras each of which %u can proc, %u proc events\n", unitCount, aurasPerUnit, procAurasPerUnit, eventCount);
+
+    std::minstd_rand random(1);
+
+    std::vector<Holder> holders(unitCount * aurasPerUnit);
+    std::vector<Unit> units(unitCount);
+    for (uint32 u = 0; u < unitCount; ++u)
+    {
+        for (uint32 a = 0; a < aurasPerUnit; ++a)
+        {
+            Holder& holder = holders[u * aurasPerUnit + a];
+            holder.id = 1 + random() % 50000;
+            holder.procFlags = a < procAurasPerUnit ? (1u << (random() % 20)) | (1u << (random() % 20)) : 0;
+            holder.schoolMask = random() % 4 == 0 ? 1u << (random() % 7) : 0;
+            holder.ready = true;
+
+            units[u].holders.emplace(holder.id, &holder);
+            units[u].procHolders.Add(&holder);
+        }
+    }
+
+    std::vector<Event> events(eventCount);
+    for (Event& event : events)
+        event = Event{uint32(random() % unitCount), 1u << (random() % 20), 1u << (random() % 7)};
+
+    uint64 walkTriggered, indexTriggered;
+    double walkMs = Run(events, walkTriggered, [&](Event const& event)
+    {
+        uint32 count = 0;
+        for (auto const& itr : units[event.unit].holders)
+            if (itr.second->ready && IsTriggered(itr.second, event))
+                ++count;
+        return count;
+    });
+    double indexMs = Run(events, indexTriggered, [&](Event const& event)
+    {
+        Unit const& unit = units[event.unit];
+        if (!unit.procHolders.CanProc(event.procFlags))
+            return 0u;
+
+        uint32 count = 0;
+        for (Holder const* holder : unit.procHolders)
+        {
+            if (!(holder->GetProcFlags() & event.procFlags))
+                continue;
+            if (holder->ready && IsTriggered(holder, event))
+                ++count;
+        }
+        return count;
+    });
+
+    if (walkTriggered != indexTriggered)
+    {
+        printf("triggered holders differ\n");
+        return 1;
+    }
+
+    printf("all holders     : %8.1f ms, %llu triggered\n", walkMs, (unsigned long long)walkTriggered);
+    printf("AuraProcIndex   : %8.1f ms, %llu triggered\n", indexMs, (unsigned long long)indexTriggered);
+    printf("speedup         : %8.2fx\n", indexMs > 0.0 ? walkMs / indexMs : 0.0);
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Channel broadcast to a big channel (5000 members by default) over the cached member pointers against
+// the per member player lookup (sObjectMgr.GetPlayer, a HashMapHolder find) it replaced. Each send copies
+// the packet into the member's outgoing buffer like WorldSocket does, so the ratio shows what share of
+// a broadcast the lookups were.
+
+#include "Globals/HashMapHolderImpl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct BenchPlayer
+    {
+        ObjectGuid guid;
+        std::vector<uint8> outgoing;
+
+        ObjectGuid GetObjectGuid() const { return guid; }
+
+        void SendPacket(std::vector<uint8> const& packet)
+        {
+            outgoing.assign(packet.begin(), packet.end());
+        }
+    };
+
+    // Channel::PlayerInfo without the unused flags
+    struct PlayerInfo
+    {
+        uint32 memberIndex;
+    };
+
+    template<class Broadcast>
+    double Run(uint32 broadcasts, Broadcast broadcast)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < broadcasts; ++i)
+            broadcast();
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / broadcasts;
+    }
+}
+
+template class HashMapHolder<BenchPlayer>;
+
+int main(int argc, char** argv)
+{
+    uint32 memberCount = argc > 1 ? uint32(atoi(argv[1])) : 5000;
+    uint32 onlineCount = argc > 2 ? uint32(atoi(argv[2])) : 10000;
+    uint32 broadcasts = argc > 3 ? uint32(atoi(argv[3])) : 2000;
+
+    if (memberCount > onlineCount)
+        onlineCount = memberCount;
+
+    printf("%u members, %u online players, %u broadcasts\n", memberCount, onlineCount, broadcasts);
+
+    std::vector<BenchPlayer> players(onlineCount);
+    for (uint32 i = 0; i < onlineCount; ++i)
+    {
+        players[i].guid = ObjectGuid(HIGHGUID_PLAYER, i + 1);
+        HashMapHolder<BenchPlayer>::Insert(&players[i]);
+    }
+
+    // random members, the channel member map is ordered by guid
+    std::minstd_rand random(1);
+    std::vector<BenchPlayer*> shuffled;
+    for (BenchPlayer& player : players)
+        shuffled.push_back(&player);
+    std::shuffle(shuffled.begin(), shuffled.end(), random);
+
+    std::map<ObjectGuid, PlayerInfo> channelPlayers;
+    std::vector<BenchPlayer*> channelMembers;
+    for (uint32 i = 0; i < memberCount; ++i)
+    {
+        channelPlayers[shuffled[i]->guid] = PlayerInfo{uint32(channelMembers.size())};
+        channelMembers.push_back(shuffled[i]);
+    }
+
+    std::vector<uint8> packet(64, 0x2A);
+
+    double lookupUs = Run(broadcasts, [&]()
+    {
+        for (auto const& itr : channelPlayers)
+            if (BenchPlayer* player = HashMapHolder<BenchPlayer>::Find(itr.first))
+                player->SendPacket(packet);
+    });
+    double cachedUs = Run(broadcasts, [&]()
+    {
+        for (BenchPlayer* member : channelMembers)
+            member->SendPacket(packet);
+    });
+
+    printf("lookup per member : %8.1f us per broadcast\n", lookupUs);
+    printf("cached members    : %8.1f us per broadcast\n", cachedUs);
+    printf("speedup           : %8.2fx\n", cachedUs > 0.0 ? lookupUs / cachedUs : 0.0);
+    return 0;
+}
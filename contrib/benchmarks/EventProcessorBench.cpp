@@ -0,0 +1,131 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// EventProcessor (sorted vector) against the multimap based processor it replaced.
+// Every unit owns a processor holding a few events that re-arm themselves up to 2s ahead,
+// all processors are updated with 50ms world ticks like the map update does.
+
+#include "Utilities/EventProcessor.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+
+namespace
+{
+    // EventProcessor as it was before events were kept in a sorted vector
+    class MultimapEventProcessor
+    {
+        public:
+            MultimapEventProcessor() : m_time(0) {}
+            ~MultimapEventProcessor()
+            {
+                for (auto& queued : m_events)
+                    delete queued.second;
+            }
+
+            void Update(uint32 p_time)
+            {
+                m_time += p_time;
+
+                std::multimap<uint64, BasicEvent*>::iterator i;
+                while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+                {
+                    BasicEvent* event = i->second;
+                    m_events.erase(i);
+
+                    if (event->Execute(m_time, p_time))
+                        delete event;
+                }
+            }
+
+            void AddEvent(BasicEvent* event, uint64 e_time, bool set_addtime = true)
+            {
+                if (set_addtime)
+                    event->m_addTime = m_time;
+
+                event->m_execTime = e_time;
+                m_events.insert(std::pair<uint64, BasicEvent*>(e_time, event));
+            }
+
+            uint64 CalculateTime(uint64 t_offset) const { return m_time + t_offset; }
+
+        private:
+            uint64 m_time;
+            std::multimap<uint64, BasicEvent*> m_events;
+    };
+
+    std::minstd_rand s_random;
+
+    template<class Processor>
+    class RearmEvent : public BasicEvent
+    {
+        public:
+            RearmEvent(Processor& processor, uint64& executed) : m_processor(processor), m_executed(executed) {}
+
+            bool Execute(uint64 e_time, uint32 /*p_time*/) override
+            {
+                ++m_executed;
+                m_processor.AddEvent(this, e_time + 1 + s_random() % 2000, false);
+                return false;
+            }
+
+        private:
+            Processor& m_processor;
+            uint64& m_executed;
+    };
+
+    template<class Processor>
+    double Run(uint32 processorCount, uint32 eventsPerProcessor, uint32 ticks, uint64& executed)
+    {
+        s_random.seed(1);
+        executed = 0;
+
+        std::vector<Processor> processors(processorCount);
+        for (Processor& processor : processors)
+            for (uint32 i = 0; i < eventsPerProcessor; ++i)
+                processor.AddEvent(new RearmEvent<Processor>(processor, executed), processor.CalculateTime(1 + s_random() % 2000));
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 tick = 0; tick < ticks; ++tick)
+            for (Processor& processor : processors)
+                processor.Update(50);
+
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32 processorCount = argc > 1 ? uint32(atoi(argv[1])) : 20000;
+    uint32 eventsPerProcessor = argc > 2 ? uint32(atoi(argv[2])) : 4;
+    uint32 ticks = argc > 3 ? uint32(atoi(argv[3])) : 2000;
+
+    printf("%u processors, %u events each, %u ticks of 50ms\n", processorCount, eventsPerProcessor, ticks);
+
+    uint64 executedMap, executedVector;
+    double multimapMs = Run<MultimapEventProcessor>(processorCount, eventsPerProcessor, ticks, executedMap);
+    double vectorMs = Run<EventProcessor>(processorCount, eventsPerProcessor, ticks, executedVector);
+
+    printf("multimap      : %8.1f ms, %llu events executed\n", multimapMs, (unsigned long long)executedMap);
+    printf("sorted vector : %8.1f ms, %llu events executed\n", vectorMs, (unsigned long long)executedVector);
+    printf("speedup       : %8.2fx\n", vectorMs > 0.0 ? multimapMs / vectorMs : 0.0);
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// HashMapHolder lookups (sharded, shared locks) against the single mutex holder it replaced, with several
+// threads looking up random online objects at once like map threads calling FindPlayer and GetUnit.
+// Needs as many cores as threads to show the contention, on one core both only measure the lookup cost.
+
+#include "Globals/HashMapHolderImpl.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct BenchObject
+    {
+        ObjectGuid guid;
+        ObjectGuid GetObjectGuid() const { return guid; }
+    };
+
+    // HashMapHolder as it was before lookups were sharded
+    class MutexHolder
+    {
+        public:
+            static void Insert(BenchObject* o)
+            {
+                std::lock_guard<std::mutex> guard(i_lock);
+                m_objectMap[o->GetObjectGuid()] = o;
+            }
+
+            static BenchObject* Find(ObjectGuid guid)
+            {
+                std::lock_guard<std::mutex> guard(i_lock);
+                auto itr = m_objectMap.find(guid);
+                return (itr != m_objectMap.end()) ? itr->second : nullptr;
+            }
+
+        private:
+            static std::mutex i_lock;
+            static std::unordered_map<ObjectGuid, BenchObject*> m_objectMap;
+    };
+
+    std::mutex MutexHolder::i_lock;
+    std::unordered_map<ObjectGuid, BenchObject*> MutexHolder::m_objectMap;
+
+    template<class Holder>
+    double Run(std::vector<BenchObject> const& objects, uint32 threadCount, uint32 lookupsPerThread, uint64& found)
+    {
+        std::atomic<uint64> foundTotal(0);
+        std::vector<std::thread> threads;
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&objects, lookupsPerThread, &foundTotal, t]()
+            {
+                std::minstd_rand random(t + 1);
+                uint64 hits = 0;
+                for (uint32 i = 0; i < lookupsPerThread; ++i)
+                    if (Holder::Find(objects[random() % objects.size()].guid))
+                        ++hits;
+                foundTotal += hits;
+            });
+        }
+        for (std::thread& thread : threads)
+            thread.join();
+
+        found = foundTotal;
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+template class HashMapHolder<BenchObject>;
+
+int main(int argc, char** argv)
+{
+    uint32 objectCount = argc > 1 ? uint32(atoi(argv[1])) : 3000;
+    uint32 threadCount = argc > 2 ? uint32(atoi(argv[2])) : 8;
+    uint32 lookupsPerThread = argc > 3 ? uint32(atoi(argv[3])) : 2000000;
+
+    printf("%u objects, %u threads, %u lookups per thread, %u hardware threads\n", objectCount, threadCount, lookupsPerThread, std::thread::hardware_concurrency());
+
+    std::vector<BenchObject> objects(objectCount);
+    for (uint32 i = 0; i < objectCount; ++i)
+    {
+        objects[i].guid = ObjectGuid(HIGHGUID_PLAYER, i + 1);
+        MutexHolder::Insert(&objects[i]);
+        HashMapHolder<BenchObject>::Insert(&objects[i]);
+    }
+
+    uint64 mutexFound, shardedFound;
+    double mutexMs = Run<MutexHolder>(objects, threadCount, lookupsPerThread, mutexFound);
+    double shardedMs = Run<HashMapHolder<BenchObject>>(objects, threadCount, lookupsPerThread, shardedFound);
+
+    if (mutexFound != shardedFound)
+    {
+        printf("lookup results differ\n");
+        return 1;
+    }
+
+    printf("single mutex : %8.1f ms\n", mutexMs);
+    printf("sharded      : %8.1f ms\n", shardedMs);
+    printf("speedup      : %8.2fx\n", shardedMs > 0.0 ? mutexMs / shardedMs : 0.0);
+    return 0;
+}
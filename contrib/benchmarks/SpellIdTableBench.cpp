@@ -0,0 +1,144 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// SpellMgr side table lookups through SpellIdTable / SpellIdRangeTable against the std::map and
+// std::multimap lookups they replaced, with table sizes of the spell_threat and spell_learn_spell tables.
+// A quarter of the looked up ids have an entry, like on the cast and proc paths.
+
+#include "Spells/SpellIdTable.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+
+namespace
+{
+    struct ThreatEntry
+    {
+        float threat;
+        float multiplier;
+        float ap;
+    };
+
+    struct LearnNode
+    {
+        uint32 spell;
+        bool active;
+    };
+
+    const uint32 MAX_SPELL_ID = 60000;
+
+    std::vector<uint32> BuildLookups(std::vector<uint32> const& ids, uint32 count, std::minstd_rand& random)
+    {
+        std::vector<uint32> lookups(count);
+        for (uint32& id : lookups)
+            id = random() % 4 == 0 ? ids[random() % ids.size()] : random() % MAX_SPELL_ID;
+        return lookups;
+    }
+
+    template<class Lookup>
+    double Measure(std::vector<uint32> const& lookups, uint64& checksum, Lookup lookup)
+    {
+        checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 id : lookups)
+            checksum += lookup(id);
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / lookups.size();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32 threatCount = argc > 1 ? uint32(atoi(argv[1])) : 1500;
+    uint32 learnCount = argc > 2 ? uint32(atoi(argv[2])) : 3000;
+    uint32 lookupCount = argc > 3 ? uint32(atoi(argv[3])) : 1000000;
+
+    printf("%u single entries, %u multi entries, %u lookups of ids below %u\n", threatCount, learnCount, lookupCount, MAX_SPELL_ID);
+
+    std::minstd_rand random(1);
+
+    std::map<uint32, ThreatEntry> threatMap;
+    std::vector<uint32> threatIds;
+    while (threatMap.size() < threatCount)
+    {
+        uint32 id = random() % MAX_SPELL_ID;
+        if (threatMap.emplace(id, ThreatEntry{float(id), 1.0f, 0.0f}).second)
+            threatIds.push_back(id);
+    }
+
+    // a few spells teach several others
+    std::multimap<uint32, LearnNode> learnMap;
+    std::vector<uint32> learnIds;
+    while (learnMap.size() < learnCount)
+    {
+        uint32 id = random() % MAX_SPELL_ID;
+        learnIds.push_back(id);
+        for (uint32 i = 1 + random() % 3; i > 0; --i)
+            learnMap.emplace(id, LearnNode{id + i, true});
+    }
+
+    SpellIdTable<ThreatEntry> threatTable;
+    threatTable.Build(threatMap);
+    SpellIdRangeTable<LearnNode> learnTable;
+    learnTable.Build(learnMap);
+
+    std::vector<uint32> threatLookups = BuildLookups(threatIds, lookupCount, random);
+    std::vector<uint32> learnLookups = BuildLookups(learnIds, lookupCount, random);
+
+    uint64 mapSum, tableSum, multimapSum, rangeSum;
+    double mapNs = Measure(threatLookups, mapSum, [&](uint32 id)
+    {
+        auto itr = threatMap.find(id);
+        return itr != threatMap.end() ? uint64(itr->second.threat) : 0;
+    });
+    double tableNs = Measure(threatLookups, tableSum, [&](uint32 id)
+    {
+        ThreatEntry const* entry = threatTable.Find(id);
+        return entry ? uint64(entry->threat) : 0;
+    });
+    double multimapNs = Measure(learnLookups, multimapSum, [&](uint32 id)
+    {
+        uint64 sum = 0;
+        auto bounds = learnMap.equal_range(id);
+        for (auto itr = bounds.first; itr != bounds.second; ++itr)
+            sum += itr->second.spell;
+        return sum;
+    });
+    double rangeNs = Measure(learnLookups, rangeSum, [&](uint32 id)
+    {
+        uint64 sum = 0;
+        auto bounds = learnTable.Find(id);
+        for (auto itr = bounds.first; itr != bounds.second; ++itr)
+            sum += itr->second.spell;
+        return sum;
+    });
+
+    if (mapSum != tableSum || multimapSum != rangeSum)
+    {
+        printf("lookup results differ\n");
+        return 1;
+    }
+
+    printf("map find             : %6.1f ns\n", mapNs);
+    printf("SpellIdTable         : %6.1f ns\n", tableNs);
+    printf("multimap equal_range : %6.1f ns\n", multimapNs);
+    printf("SpellIdRangeTable    : %6.1f ns\n", rangeNs);
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Threat list order restored by ResortNearlySorted against the full list::sort done before on every
+// threat change. Each update a few refs of a creature's threat list gain damage-driven threat, like
+// in a raid fight, then the order is restored once.
+
+#include "Common.h"
+#include "Combat/ThreatListResort.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Ref
+    {
+        int taunt;
+        int hostile;
+        float threat;
+    };
+
+    // same order as ThreatContainer::isHigherPriority
+    bool IsHigherPriority(Ref const* lhs, Ref const* rhs)
+    {
+        if (lhs->taunt != rhs->taunt)
+            return lhs->taunt > rhs->taunt;
+        if (lhs->hostile != rhs->hostile)
+            return lhs->hostile > rhs->hostile;
+        return lhs->threat > rhs->threat;
+    }
+
+    template<class Resort>
+    double Run(uint32 refCount, uint32 changedPerUpdate, uint32 updates, std::vector<float>& order, Resort resort)
+    {
+        std::minstd_rand random(1);
+
+        std::vector<Ref> refs(refCount);
+        std::list<Ref*> threatList;
+        for (Ref& ref : refs)
+        {
+            ref = Ref{0, 1, float(random() % 10000)};
+            threatList.push_back(&ref);
+        }
+        threatList.sort(IsHigherPriority);
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 update = 0; update < updates; ++update)
+        {
+            for (uint32 i = 0; i < changedPerUpdate; ++i)
+                refs[random() % refCount].threat += float(random() % 500);
+
+            resort(threatList);
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        order.clear();
+        for (Ref const* ref : threatList)
+            order.push_back(ref->threat);
+        return ms;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    uint32 refCount = argc > 1 ? uint32(atoi(argv[1])) : 40;
+    uint32 changedPerUpdate = argc > 2 ? uint32(atoi(argv[2])) : 3;
+    uint32 updates = argc > 3 ? uint32(atoi(argv[3])) : 200000;
+
+    printf("%u refs, %u threat changes per update, %u updates\n", refCount, changedPerUpdate, updates);
+
+    std::vector<float> sortOrder, resortOrder;
+    double sortMs = Run(refCount, changedPerUpdate, updates, sortOrder, [](std::list<Ref*>& list) { list.sort(IsHigherPriority); });
+    double resortMs = Run(refCount, changedPerUpdate, updates, resortOrder, [](std::list<Ref*>& list) { ResortNearlySorted(list, IsHigherPriority); });
+
+    if (sortOrder != resortOrder)
+    {
+        printf("resulting orders differ\n");
+        return 1;
+    }
+
+    printf("list::sort         : %8.1f ms\n", sortMs);
+    printf("ResortNearlySorted : %8.1f ms\n", resortMs);
+    printf("speedup            : %8.2fx\n", resortMs > 0.0 ? sortMs / resortMs : 0.0);
+    return 0;
+}
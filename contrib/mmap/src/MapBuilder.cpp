@@ -21,12 +21,14 @@
 
 #include "MapTree.h"
 #include "ModelInstance.h"
+#include "VMapManager2.h"
 
 #include "DetourNavMeshBuilder.h"
 #include "DetourCommon.h"
 
 #include <climits>
 #include <fstream>
+#include <thread>
 
 using namespace VMAP;
 
@@ -51,20 +53,56 @@ void from_json(const json& j, rcConfig& config)
 
 namespace MMAP
 {
+    // 64-bit FNV-1a, only used to detect changed tile inputs
+    static const uint64 FNV_OFFSET_BASIS = 14695981039346656037ULL;
+    static const uint64 FNV_PRIME = 1099511628211ULL;
+
+    static void hashBytes(uint64& hash, const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= FNV_PRIME;
+        }
+    }
+
+    static void hashFile(uint64& hash, const char* fileName)
+    {
+        FILE* file = fopen(fileName, "rb");
+
+        // a missing neighbour is an input too, appearing or vanishing must change the hash
+        unsigned char exists = file ? 1 : 0;
+        hashBytes(hash, &exists, 1);
+        if (!file)
+            return;
+
+        char buffer[64 * 1024];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            hashBytes(hash, buffer, count);
+
+        fclose(file);
+    }
+
     MapBuilder::MapBuilder(const char* configInputPath, bool skipLiquid, bool skipContinents, bool skipJunkMaps,
-                           bool skipBattlegrounds, bool debug, const char* offMeshFilePath) :
+                           bool skipBattlegrounds, bool debug, const char* offMeshFilePath, uint32 threads, bool forceRebuild) :
         m_debug(debug),
         m_skipContinents(skipContinents),
         m_skipJunkMaps(skipJunkMaps),
         m_skipBattlegrounds(skipBattlegrounds),
-        m_offMeshFilePath(offMeshFilePath)
+        m_offMeshFilePath(offMeshFilePath),
+        m_threads(threads ? threads : 1),
+        m_forceRebuild(forceRebuild),
+        m_nextJob(0),
+        m_builtTiles(0),
+        m_skippedTiles(0)
     {
         std::ifstream jsonConfig(configInputPath);
         if (jsonConfig)
             m_config = json::parse(jsonConfig);
 
         m_terrainBuilder = new TerrainBuilder(skipLiquid);
-        m_rcContext = new rcContext(false);
 
         discoverTiles();
     }
@@ -79,7 +117,6 @@ namespace MMAP
         }
 
         delete m_terrainBuilder;
-        delete m_rcContext;
     }
 
     /**************************************************************************/
@@ -263,28 +300,72 @@ namespace MMAP
         // now start building mmtiles for each tile
         printf("[Map %03i] We have %u tiles.                          \n", mapID, uint32(tiles->size()));
 
-        uint32 currentTile = 0;
-        for (std::set<uint32>::iterator it = tiles->begin(); it != tiles->end(); ++it)
+        std::vector<uint32> jobs(tiles->begin(), tiles->end());
+        m_nextJob = 0;
+        m_builtTiles = 0;
+        m_skippedTiles = 0;
+        m_buildStart = std::chrono::steady_clock::now();
+
+        uint32 threadCount = std::min(m_threads, uint32(jobs.size()));
+        if (threadCount > 1)
+        {
+            std::vector<std::thread> workers;
+            for (uint32 i = 0; i < threadCount; ++i)
+                workers.emplace_back(&MapBuilder::buildTileJobs, this, mapID, std::cref(jobs), navMesh);
+
+            for (std::thread& worker : workers)
+                worker.join();
+        }
+        else
+            buildTileJobs(mapID, jobs, navMesh);
+
+        dtFreeNavMesh(navMesh);
+
+        float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_buildStart).count();
+        printf("[Map %03i] Complete! %u built, %u unchanged in %.1fs (%.2f tiles/s)\n\n", mapID,
+               uint32(m_builtTiles), uint32(m_skippedTiles), elapsed, elapsed > 0.0f ? m_builtTiles / elapsed : 0.0f);
+    }
+
+    /**************************************************************************/
+    void MapBuilder::buildTileJobs(uint32 mapID, std::vector<uint32> const& jobs, dtNavMesh* navMesh)
+    {
+        uint32 tileCount = uint32(jobs.size());
+        for (uint32 index = m_nextJob++; index < tileCount; index = m_nextJob++)
         {
-            currentTile++;
             uint32 tileX, tileY;
 
             // unpack tile coords
-            StaticMapTree::unpackTileID((*it), tileX, tileY);
+            StaticMapTree::unpackTileID(jobs[index], tileX, tileY);
 
-            if (shouldSkipTile(mapID, tileX, tileY))
+            uint64 inputHash = getTileInputHash(mapID, tileX, tileY);
+            if (!m_forceRebuild && shouldSkipTile(mapID, tileX, tileY, inputHash))
+            {
+                ++m_skippedTiles;
                 continue;
+            }
 
-            buildTile(mapID, tileX, tileY, navMesh, currentTile, uint32(tiles->size()));
-        }
+            TileBuildResult result = buildTile(mapID, tileX, tileY, navMesh, index + 1, tileCount);
+            if (result == TILE_NO_GEOMETRY)
+            {
+                // inputs changed and the tile has no navmesh anymore, drop the stale one
+                char fileName[255];
+                sprintf(fileName, "mmaps/%03u%02i%02i.mmtile", mapID, tileY, tileX);
+                remove(fileName);
+            }
 
-        dtFreeNavMesh(navMesh);
+            // no hash for failed tiles, so they are retried by the next run
+            if (result != TILE_BUILD_FAILED)
+                writeTileInputHash(mapID, tileX, tileY, inputHash, result == TILE_BUILT);
 
-        printf("[Map %03i] Complete!                             \n\n", mapID);
+            uint32 built = ++m_builtTiles;
+            float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_buildStart).count();
+            printf("[Map %03i] Progress: %u / %u tiles, %u unchanged (%.2f tiles/s)     \n", mapID,
+                   built + uint32(m_skippedTiles), tileCount, uint32(m_skippedTiles), elapsed > 0.0f ? built / elapsed : 0.0f);
+        }
     }
 
     /**************************************************************************/
-    void MapBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh, uint32 curTile, uint32 tileCount)
+    TileBuildResult MapBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh, uint32 curTile, uint32 tileCount)
     {
         printf("[Map %03i] Building tile [%02u,%02u] (%02u / %02u)    \n", mapID, tileX, tileY, curTile, tileCount);
 
@@ -298,7 +379,7 @@ namespace MMAP
 
         // if there is no data, give up now
         if (!meshData.solidVerts.size() && !meshData.liquidVerts.size())
-            return;
+            return TILE_NO_GEOMETRY;
 
         // remove unused vertices
         TerrainBuilder::cleanVertices(meshData.solidVerts, meshData.solidTris);
@@ -310,7 +391,7 @@ namespace MMAP
         allVerts.append(meshData.solidVerts);
 
         if (!allVerts.size())
-            return;
+            return TILE_NO_GEOMETRY;
 
         // get bounds of current tile
         float bmin[3], bmax[3];
@@ -319,7 +400,7 @@ namespace MMAP
         m_terrainBuilder->loadOffMeshConnections(mapID, tileX, tileY, meshData, m_offMeshFilePath);
 
         // build navmesh tile
-        buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh);
+        return buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh);
     }
 
     /**************************************************************************/
@@ -398,10 +479,13 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void MapBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
+    TileBuildResult MapBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
                                       MeshData& meshData, float bmin[3], float bmax[3],
                                       dtNavMesh* navMesh)
     {
+        // one context per tile so workers do not share recast state
+        rcContext context(false);
+
         // console output
         char tileString[20];
         sprintf(tileString, "[Map %03i] [%02i,%02i]: ", mapID, tileX, tileY);
@@ -460,7 +544,7 @@ namespace MMAP
 
                 // Build heightfield for walkable area
                 tile.solid = rcAllocHeightfield();
-                if (!tile.solid || !rcCreateHeightfield(m_rcContext, *tile.solid, tileCfg.width, tileCfg.height, tileCfg.bmin, tileCfg.bmax, tileCfg.cs, tileCfg.ch))
+                if (!tile.solid || !rcCreateHeightfield(&context, *tile.solid, tileCfg.width, tileCfg.height, tileCfg.bmin, tileCfg.bmax, tileCfg.cs, tileCfg.ch))
                 {
                     printf("%s Failed building heightfield!                       \n", tileString);
                     continue;
@@ -469,50 +553,50 @@ namespace MMAP
                 // mark all walkable tiles, both liquids and solids
                 unsigned char* triFlags = new unsigned char[tTriCount];
                 memset(triFlags, NAV_GROUND, tTriCount * sizeof(unsigned char));
-                rcClearUnwalkableTriangles(m_rcContext, tileCfg.walkableSlopeAngle, tVerts, tVertCount, tTris, tTriCount, triFlags);
-                rcRasterizeTriangles(m_rcContext, tVerts, tVertCount, tTris, triFlags, tTriCount, *tile.solid, config.walkableClimb);
+                rcClearUnwalkableTriangles(&context, tileCfg.walkableSlopeAngle, tVerts, tVertCount, tTris, tTriCount, triFlags);
+                rcRasterizeTriangles(&context, tVerts, tVertCount, tTris, triFlags, tTriCount, *tile.solid, config.walkableClimb);
                 delete [] triFlags;
 
-                rcFilterLowHangingWalkableObstacles(m_rcContext, config.walkableClimb, *tile.solid);
-                rcFilterLedgeSpans(m_rcContext, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid);
-                rcFilterWalkableLowHeightSpans(m_rcContext, tileCfg.walkableHeight, *tile.solid);
-                rcRasterizeTriangles(m_rcContext, lVerts, lVertCount, lTris, lTriFlags, lTriCount, *tile.solid, config.walkableClimb);
+                rcFilterLowHangingWalkableObstacles(&context, config.walkableClimb, *tile.solid);
+                rcFilterLedgeSpans(&context, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid);
+                rcFilterWalkableLowHeightSpans(&context, tileCfg.walkableHeight, *tile.solid);
+                rcRasterizeTriangles(&context, lVerts, lVertCount, lTris, lTriFlags, lTriCount, *tile.solid, config.walkableClimb);
 
                 // compact heightfield spans
                 tile.chf = rcAllocCompactHeightfield();
-                if (!tile.chf || !rcBuildCompactHeightfield(m_rcContext, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid, *tile.chf))
+                if (!tile.chf || !rcBuildCompactHeightfield(&context, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid, *tile.chf))
                 {
                     printf("%s Failed compacting heightfield!                     \n", tileString);
                     continue;
                 }
 
                 // build polymesh intermediates
-                if (!rcErodeWalkableArea(m_rcContext, config.walkableRadius, *tile.chf))
+                if (!rcErodeWalkableArea(&context, config.walkableRadius, *tile.chf))
                 {
                     printf("%s Failed eroding area!                               \n", tileString);
                     continue;
                 }
 
-                if (!rcMedianFilterWalkableArea(m_rcContext, *tile.chf))
+                if (!rcMedianFilterWalkableArea(&context, *tile.chf))
                 {
                     printf("%s Failed filtering area!                             \n", tileString);
                     continue;
                 }
 
-                if (!rcBuildDistanceField(m_rcContext, *tile.chf))
+                if (!rcBuildDistanceField(&context, *tile.chf))
                 {
                     printf("%s Failed building distance field!                    \n", tileString);
                     continue;
                 }
 
-                if (!rcBuildRegions(m_rcContext, *tile.chf, tileCfg.borderSize, tileCfg.minRegionArea, tileCfg.mergeRegionArea))
+                if (!rcBuildRegions(&context, *tile.chf, tileCfg.borderSize, tileCfg.minRegionArea, tileCfg.mergeRegionArea))
                 {
                     printf("%s Failed building regions!                           \n", tileString);
                     continue;
                 }
 
                 tile.cset = rcAllocContourSet();
-                if (!tile.cset || !rcBuildContours(m_rcContext, *tile.chf, tileCfg.maxSimplificationError, tileCfg.maxEdgeLen, *tile.cset))
+                if (!tile.cset || !rcBuildContours(&context, *tile.chf, tileCfg.maxSimplificationError, tileCfg.maxEdgeLen, *tile.cset))
                 {
                     printf("%s Failed building contours!                          \n", tileString);
                     continue;
@@ -520,14 +604,14 @@ namespace MMAP
 
                 // build polymesh
                 tile.pmesh = rcAllocPolyMesh();
-                if (!tile.pmesh || !rcBuildPolyMesh(m_rcContext, *tile.cset, tileCfg.maxVertsPerPoly, *tile.pmesh))
+                if (!tile.pmesh || !rcBuildPolyMesh(&context, *tile.cset, tileCfg.maxVertsPerPoly, *tile.pmesh))
                 {
                     printf("%s Failed building polymesh!                          \n", tileString);
                     continue;
                 }
 
                 tile.dmesh = rcAllocPolyMeshDetail();
-                if (!tile.dmesh || !rcBuildPolyMeshDetail(m_rcContext, *tile.pmesh, *tile.chf, tileCfg.detailSampleDist, tileCfg    .detailSampleMaxError, *tile.dmesh))
+                if (!tile.dmesh || !rcBuildPolyMeshDetail(&context, *tile.pmesh, *tile.chf, tileCfg.detailSampleDist, tileCfg    .detailSampleMaxError, *tile.dmesh))
                 {
                     printf("%s Failed building polymesh detail!                   \n", tileString);
                     continue;
@@ -571,9 +655,9 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return TILE_BUILD_FAILED;
         }
-        rcMergePolyMeshes(m_rcContext, pmmerge, nmerge, *iv.polyMesh);
+        rcMergePolyMeshes(&context, pmmerge, nmerge, *iv.polyMesh);
 
         iv.polyMeshDetail = rcAllocPolyMeshDetail();
         if (!iv.polyMeshDetail)
@@ -582,9 +666,9 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return TILE_BUILD_FAILED;
         }
-        rcMergePolyMeshDetails(m_rcContext, dmmerge, nmerge, *iv.polyMeshDetail);
+        rcMergePolyMeshDetails(&context, dmmerge, nmerge, *iv.polyMeshDetail);
 
         // free things up
         delete [] pmmerge;
@@ -636,6 +720,7 @@ namespace MMAP
         // will hold final navmesh
         unsigned char* navData = NULL;
         int navDataSize = 0;
+        TileBuildResult result = TILE_BUILD_FAILED;
 
         do
         {
@@ -658,6 +743,7 @@ namespace MMAP
 
                 // message is an annoyance
                 //printf("%sNo vertices to build tile!              \n", tileString);
+                result = TILE_NO_GEOMETRY;
                 continue;
             }
             if (!params.polyCount || !params.polys ||
@@ -667,6 +753,7 @@ namespace MMAP
                 // keep in mind that we do output those into debug info
                 // drop tiles with only exact count - some tiles may have geometry while having less tiles
                 printf("%s No polygons to build on tile!                      \n", tileString);
+                result = TILE_NO_GEOMETRY;
                 continue;
             }
             if (!params.detailMeshes || !params.detailVerts || !params.detailTris)
@@ -683,10 +770,14 @@ namespace MMAP
             }
 
             dtTileRef tileRef = 0;
+            dtStatus dtResult;
             printf("%s Adding tile to navmesh...                          \r", tileString);
-            // DT_TILE_FREE_DATA tells detour to unallocate memory when the tile
-            // is removed via removeTile()
-            dtStatus dtResult = navMesh->addTile(navData, navDataSize, DT_TILE_FREE_DATA, 0, &tileRef);
+            {
+                std::lock_guard<std::mutex> guard(m_navMeshLock);
+                // DT_TILE_FREE_DATA tells detour to unallocate memory when the tile
+                // is removed via removeTile()
+                dtResult = navMesh->addTile(navData, navDataSize, DT_TILE_FREE_DATA, 0, &tileRef);
+            }
             if (!tileRef || dtStatusFailed(dtResult))
             {
                 printf("%s Failed adding tile to navmesh!                     \n", tileString);
@@ -702,6 +793,7 @@ namespace MMAP
                 char message[1024];
                 sprintf(message, "[Map %03i] Failed to open %s for writing!             \n", mapID, fileName);
                 perror(message);
+                std::lock_guard<std::mutex> guard(m_navMeshLock);
                 navMesh->removeTile(tileRef, NULL, NULL);
                 continue;
             }
@@ -717,8 +809,10 @@ namespace MMAP
             // write data
             fwrite(navData, sizeof(unsigned char), navDataSize, file);
             fclose(file);
+            result = TILE_BUILT;
 
             // now that tile is written to disk, we can unload it
+            std::lock_guard<std::mutex> guard(m_navMeshLock);
             navMesh->removeTile(tileRef, NULL, NULL);
         }
         while (0);
@@ -736,6 +830,8 @@ namespace MMAP
             iv.generateObjFile(mapID, tileX, tileY, meshData);
             iv.writeIV(mapID, tileX, tileY);
         }
+
+        return result;
     }
 
     /**************************************************************************/
@@ -848,6 +944,94 @@ namespace MMAP
         return true;
     }
 
+    /**************************************************************************/
+    bool MapBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash)
+    {
+        char fileName[255];
+        sprintf(fileName, "mmaps/%03u%02i%02i.mmhash", mapID, tileY, tileX);
+        FILE* file = fopen(fileName, "rb");
+        if (!file)
+            return false;
+
+        unsigned long long storedHash = 0;
+        unsigned int hasTile = 0;
+        int count = fscanf(file, "%llx %u", &storedHash, &hasTile);
+        fclose(file);
+        if (count != 2 || uint64(storedHash) != inputHash)
+            return false;
+
+        // tiles without geometry have no .mmtile, nothing more to check
+        if (!hasTile)
+            return true;
+
+        return shouldSkipTile(mapID, tileX, tileY);
+    }
+
+    /**************************************************************************/
+    uint64 MapBuilder::getTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        uint64 hash = FNV_OFFSET_BASIS;
+
+        // generator settings that change the output without touching the input files
+        uint32 settings[3] = { MMAP_VERSION, uint32(DT_NAVMESH_VERSION), m_terrainBuilder->usesLiquids() ? 1u : 0u };
+        hashBytes(hash, settings, sizeof(settings));
+
+        std::string config = getTileConfig(mapID, tileX, tileY).dump();
+        hashBytes(hash, config.data(), config.size());
+
+        // the tile terrain and the neighbour borders, see TerrainBuilder::loadMap
+        const uint32 mapTiles[5][2] = { { tileX, tileY }, { tileX + 1, tileY }, { tileX - 1, tileY }, { tileX, tileY + 1 }, { tileX, tileY - 1 } };
+        char fileName[255];
+        for (int i = 0; i < 5; ++i)
+        {
+            sprintf(fileName, "maps/%03u%02u%02u.map", mapID, mapTiles[i][1], mapTiles[i][0]);
+            hashFile(hash, fileName);
+        }
+
+        // model spawns, see TerrainBuilder::loadVMap
+        hashFile(hash, ("vmaps/" + VMapManager2::getMapFileName(mapID)).c_str());
+        hashFile(hash, ("vmaps/" + StaticMapTree::getTileFileName(mapID, tileY, tileX)).c_str());
+
+        // off mesh connections of this tile, see TerrainBuilder::loadOffMeshConnections
+        if (FILE* fp = m_offMeshFilePath ? fopen(m_offMeshFilePath, "rb") : NULL)
+        {
+            char buf[512];
+            while (fgets(buf, 512, fp))
+            {
+                float p[7];
+                int mid, tx, ty;
+                if (10 != sscanf(buf, "%d %d,%d (%f %f %f) (%f %f %f) %f", &mid, &tx, &ty,
+                                 &p[0], &p[1], &p[2], &p[3], &p[4], &p[5], &p[6]))
+                    continue;
+
+                if (uint32(mid) == mapID && uint32(tx) == tileX && uint32(ty) == tileY)
+                    hashBytes(hash, buf, strlen(buf));
+            }
+
+            fclose(fp);
+        }
+
+        return hash;
+    }
+
+    /**************************************************************************/
+    void MapBuilder::writeTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash, bool hasTile)
+    {
+        char fileName[255];
+        sprintf(fileName, "mmaps/%03u%02i%02i.mmhash", mapID, tileY, tileX);
+        FILE* file = fopen(fileName, "wb");
+        if (!file)
+        {
+            char message[1024];
+            sprintf(message, "[Map %03i] Failed to open %s for writing!             \n", mapID, fileName);
+            perror(message);
+            return;
+        }
+
+        fprintf(file, "%016llx %u\n", (unsigned long long)inputHash, hasTile ? 1 : 0);
+        fclose(file);
+    }
+
     json MapBuilder::getDefaultConfig()
     {
         return {
@@ -22,6 +22,9 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 
 #include "TerrainBuilder.h"
 #include "IntermediateValues.h"
@@ -53,6 +56,13 @@ namespace MMAP
     const static int TILES_PER_MAP = VERTEX_PER_MAP / VERTEX_PER_TILE;
 
     typedef std::map<uint32, std::set<uint32>*> TileList;
+
+    enum TileBuildResult
+    {
+        TILE_BUILT,                                         // .mmtile file written
+        TILE_NO_GEOMETRY,                                   // nothing to build a navmesh from
+        TILE_BUILD_FAILED                                   // build or write error, existing .mmtile is kept
+    };
     struct Tile
     {
         Tile() : chf(NULL), solid(NULL), cset(NULL), pmesh(NULL), dmesh(NULL) {}
@@ -81,11 +91,14 @@ namespace MMAP
                        bool skipJunkMaps        = true,
                        bool skipBattlegrounds   = false,
                        bool debug               = false,
-                       const char* offMeshFilePath = NULL);
+                       const char* offMeshFilePath = NULL,
+                       uint32 threads           = 1,
+                       bool forceRebuild        = false);
 
             ~MapBuilder();
 
             // builds all mmap tiles for the specified map id (ignores skip settings)
+            // tiles whose inputs are unchanged since the last build are skipped unless forceRebuild is set
             void buildMap(uint32 mapID);
 
             // builds an mmap tile for the specified map and its mesh
@@ -101,16 +114,24 @@ namespace MMAP
 
             void buildNavMesh(uint32 mapID, dtNavMesh*& navMesh);
 
-            void buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh, uint32 curTile, uint32 tileCount);
+            TileBuildResult buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh, uint32 curTile, uint32 tileCount);
+
+            // worker loop of buildMap, pulls tiles from the shared job index until none are left
+            void buildTileJobs(uint32 mapID, std::vector<uint32> const& jobs, dtNavMesh* navMesh);
 
             // move map building
-            void buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY, MeshData& meshData, float bmin[3], float bmax[3], dtNavMesh* navMesh);
+            TileBuildResult buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY, MeshData& meshData, float bmin[3], float bmax[3], dtNavMesh* navMesh);
             void getTileBounds(uint32 tileX, uint32 tileY, float* verts, int vertCount, float* bmin, float* bmax);
             void getGridBounds(uint32 mapID, uint32& minX, uint32& minY, uint32& maxX, uint32& maxY);
 
             bool shouldSkipMap(uint32 mapID);
             bool isTransportMap(uint32 mapID);
             bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY);
+            bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash);
+
+            // hash of everything a tile is built from: terrain, vmap tile, offmesh entries and tile config
+            uint64 getTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY);
+            void writeTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash, bool hasTile);
 
             json getDefaultConfig();
             json getMapIdConfig(uint32 mapId);
@@ -128,8 +149,17 @@ namespace MMAP
 
             json m_config;
 
-            // build performance - not really used for now
-            rcContext* m_rcContext;
+            uint32 m_threads;
+            bool m_forceRebuild;
+
+            // dtNavMesh is only used to validate tiles before writing them, but is shared by all workers
+            std::mutex m_navMeshLock;
+
+            // buildMap progress, shared by the workers
+            std::atomic<uint32> m_nextJob;
+            std::atomic<uint32> m_builtTiles;
+            std::atomic<uint32> m_skippedTiles;
+            std::chrono::steady_clock::time_point m_buildStart;
     };
 }
 
@@ -72,6 +72,8 @@ void printUsage()
     printf("--silent : Make script friendly. No wait for user input, error, completion.\n");
     printf("--offMeshInput [file.*] : Path to file containing off mesh connections data.\n\n");
     printf("--configInputPath [file.*] : Path to json configuration file.\n\n");
+    printf("--threads [#] : Number of tiles built in parallel (default 1)\n");
+    printf("--rebuild : Rebuild all tiles, even those whose inputs did not change\n\n");
     printf("Example:\nmovemapgen (generate all mmap with default arg\n"
            "movemapgen 0 (generate map 0)\n"
            "movemapgen 0 --tile 34,46 (builds only tile 34,46 of map 0)\n\n");
@@ -89,7 +91,9 @@ bool handleArgs(int argc, char** argv,
                 bool& debugOutput,
                 bool& silent,
                 char*& offMeshInputPath,
-                char*& configInputPath)
+                char*& configInputPath,
+                int& threads,
+                bool& forceRebuild)
 {
     char* param = NULL;
     for (int i = 1; i < argc; ++i)
@@ -157,6 +161,23 @@ bool handleArgs(int argc, char** argv,
 
             configInputPath = param;
         }
+        else if (strcmp(argv[i], "--threads") == 0)
+        {
+            param = argv[++i];
+            if (!param)
+                return false;
+
+            threads = atoi(param);
+            if (threads < 1)
+            {
+                printf("invalid thread count.\n");
+                return false;
+            }
+        }
+        else if (strcmp(argv[i], "--rebuild") == 0)
+        {
+            forceRebuild = true;
+        }
         else if ((strcmp(argv[i], "-?") == 0) || (strcmp(argv[i], "/?") == 0) || (strcmp(argv[i], "-h") == 0))
         {
             printUsage();
@@ -196,13 +217,16 @@ int main(int argc, char** argv)
     bool skipBattlegrounds = false;
     bool debug = false;
     bool silent = false;
+    bool forceRebuild = false;
+    int threads = 1;
 
     char* offMeshInputPath = "offmesh.txt";
     char* configInputPath = "config.json";
 
     bool validParam = handleArgs(argc, argv, mapId, tileX, tileY, skipLiquid,
                                  skipContinents, skipJunkMaps, skipBattlegrounds,
-                                 debug, silent, offMeshInputPath, configInputPath);
+                                 debug, silent, offMeshInputPath, configInputPath,
+                                 threads, forceRebuild);
 
     if (!validParam)
         return silent ? -1 : finish("You have specified invalid parameters (use -? for more help)", -1);
@@ -222,7 +246,8 @@ int main(int argc, char** argv)
     if (!checkDirectories(debug))
         return silent ? -3 : finish("Press any key to close...", -3);
 
-    MapBuilder builder(configInputPath, skipLiquid, skipContinents, skipJunkMaps, skipBattlegrounds, debug, offMeshInputPath);
+    MapBuilder builder(configInputPath, skipLiquid, skipContinents, skipJunkMaps, skipBattlegrounds, debug, offMeshInputPath,
+                       uint32(threads), forceRebuild);
 
     if (tileX > -1 && tileY > -1 && mapId >= 0)
         builder.buildSingleTile(mapId, tileX, tileY);
@@ -18,24 +18,32 @@
 
 #include <string>
 #include <iostream>
+#include <thread>
+#include <cstdlib>
 
 #include "TileAssembler.h"
 
 //=======================================================
 int main(int argc, char* argv[])
 {
-    if (argc != 3)
+    if (argc != 3 && argc != 4)
     {
-        std::cout << "usage: " << argv[0] << " <raw data dir> <vmap dest dir>" << std::endl;
+        std::cout << "usage: " << argv[0] << " <raw data dir> <vmap dest dir> [threads]" << std::endl;
         return 1;
     }
 
     std::string src = argv[1];
     std::string dest = argv[2];
 
-    std::cout << "using " << src << " as source directory and writing output to " << dest << std::endl;
+    // default to one worker per core, output is identical for any thread count
+    int threads = argc == 4 ? atoi(argv[3]) : int(std::thread::hardware_concurrency());
+    if (threads < 1)
+        threads = 1;
+
+    std::cout << "using " << src << " as source directory and writing output to " << dest << " with " << threads << " threads" << std::endl;
 
     VMAP::TileAssembler tileAssembler(src, dest);
+    tileAssembler.setThreadCount(uint32(threads));
 
     if (!tileAssembler.convertWorld2())
     {
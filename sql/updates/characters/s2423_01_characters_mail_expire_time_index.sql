@@ -0,0 +1,3 @@
+ALTER TABLE character_db_version CHANGE COLUMN required_s2420_01_characters_item_instance_data_drop required_s2423_01_characters_mail_expire_time_index bit;
+
+ALTER TABLE `mail` ADD KEY `idx_expire_time` (`expire_time`);
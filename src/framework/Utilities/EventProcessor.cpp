@@ -18,6 +18,8 @@
 
 #include "EventProcessor.h"
 
+#include <algorithm>
+
 EventProcessor::EventProcessor()
 {
     m_time = 0;
@@ -34,13 +36,12 @@ void EventProcessor::Update(uint32 p_time)
     // update time
     m_time += p_time;
 
-    // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    // main event loop, due events are at the back
+    while (!m_events.empty() && m_events.back().first <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* Event = i->second;
-        m_events.erase(i);
+        BasicEvent* Event = m_events.back().second;
+        m_events.pop_back();
 
         if (!Event->to_Abort)
         {
@@ -64,20 +65,23 @@ void EventProcessor::KillAllEvents(bool force)
     m_aborting = true;
 
     // first, abort all existing events
-    for (EventList::iterator i = m_events.begin(); i != m_events.end();)
+    for (size_t i = 0; i < m_events.size();)
     {
-        EventList::iterator i_old = i;
-        ++i;
+        BasicEvent* event = m_events[i].second;
 
-        i_old->second->to_Abort = true;
-        i_old->second->Abort(m_time);
-        if (force || i_old->second->IsDeletable())
+        event->to_Abort = true;
+        event->Abort(m_time);
+        if (force || event->IsDeletable())
         {
-            delete i_old->second;
+            delete event;
 
             if (!force)                                     // need per-element cleanup
-                m_events.erase(i_old);
+            {
+                m_events.erase(m_events.begin() + i);
+                continue;
+            }
         }
+        ++i;
     }
 
     // fast clear event list (in force case)
@@ -87,14 +91,15 @@ void EventProcessor::KillAllEvents(bool force)
 
 void EventProcessor::KillEvent(BasicEvent* event)
 {
-    for (EventList::iterator iter = m_events.begin(); iter != m_events.end();)
+    // removed before deleted, the destructor may add events
+    for (size_t i = 0; i < m_events.size();)
     {
-        if (iter->second == event)
+        if (m_events[i].second == event)
         {
-            delete iter->second;
-            iter = m_events.erase(iter);
+            m_events.erase(m_events.begin() + i);
+            delete event;
         }
-        else ++iter;
+        else ++i;
     }
 }
 
@@ -104,7 +109,11 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
 
     Event->m_execTime = e_time;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+
+    // insert in front of events with the same time, these are popped first
+    EventList::iterator pos = std::lower_bound(m_events.begin(), m_events.end(), e_time,
+        [](EventList::value_type const& queued, uint64 time) { return queued.first > time; });
+    m_events.insert(pos, EventList::value_type(e_time, Event));
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
@@ -21,7 +21,8 @@
 
 #include "Platform/Define.h"
 
-#include <map>
+#include <utility>
+#include <vector>
 
 // Note. All times are in milliseconds here.
 
@@ -55,7 +56,10 @@ class BasicEvent
         uint64 m_execTime;                                  // planned time of next execution, filled by event handler
 };
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+// Sorted by descending execution time, so due events are popped from the back and inserting keeps the vector capacity.
+// Events with equal time are executed in insertion order. Units only queue a handful of events at once, so this beats
+// a node based tree or timing wheel both in allocations and in cache misses.
+typedef std::vector<std::pair<uint64, BasicEvent*> > EventList;
 
 class EventProcessor
 {
@@ -70,6 +74,7 @@ class EventProcessor
         void AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime = true);
         uint64 CalculateTime(uint64 t_offset) const;
         EventList& GetEvents() { return m_events; }
+        bool Empty() const { return m_events.empty(); }
 
     protected:
 
@@ -0,0 +1,186 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_OBJECTPOOL_H
+#define MANGOS_OBJECTPOOL_H
+
+#include "Platform/Define.h"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace MaNGOS
+{
+    // Counters of one pooled type, flushed from the threads in small batches
+    struct ObjectPoolCounters
+    {
+        std::atomic<uint64> allocated{0};                   // objects handed out
+        std::atomic<uint64> reused{0};                      // handed out objects that came from a free list
+        std::atomic<uint64> fallback{0};                    // objects of derived classes, served by the global allocator
+    };
+
+    // Base class that gives T a class specific operator new/delete backed by a thread caching free list.
+    // Freed memory goes to a thread local cache; a full cache is handed over to a shared depot as one batch
+    // and a thread with an empty cache takes a batch from there, so memory freed on another thread than it
+    // was allocated on (received packets, spells deleted by the world thread) is reused as well.
+    // Derived classes with a different size use the global allocator. Pooled memory is only returned to the system at shutdown.
+    template <class T, size_t CacheSize = 256>
+    class PooledObject
+    {
+        public:
+            static void* operator new(size_t size)
+            {
+                if (size != sizeof(T))
+                {
+                    s_counters.fallback.fetch_add(1, std::memory_order_relaxed);
+                    return ::operator new(size);
+                }
+
+                LocalCache& cache = GetLocalCache();
+                if (!cache.head && s_depotSize.load(std::memory_order_relaxed))
+                {
+                    std::lock_guard<std::mutex> guard(s_depotLock);
+                    if (!s_depot.batches.empty())
+                    {
+                        cache.head = s_depot.batches.back().head;
+                        cache.count = s_depot.batches.back().count;
+                        s_depot.batches.pop_back();
+                        s_depotSize.store(s_depot.batches.size(), std::memory_order_relaxed);
+                    }
+                }
+
+                void* ptr;
+                if (FreeBlock* block = cache.head)
+                {
+                    cache.head = block->next;
+                    --cache.count;
+                    ++cache.reused;
+                    ptr = block;
+                }
+                else
+                    ptr = ::operator new(size);
+
+                if (++cache.allocated >= COUNTER_FLUSH)
+                    cache.FlushCounters();
+
+                return ptr;
+            }
+
+            static void operator delete(void* ptr, size_t size)
+            {
+                if (!ptr)
+                    return;
+
+                if (size != sizeof(T))
+                {
+                    ::operator delete(ptr);
+                    return;
+                }
+
+                LocalCache& cache = GetLocalCache();
+                FreeBlock* block = static_cast<FreeBlock*>(ptr);
+                block->next = cache.head;
+                cache.head = block;
+                if (++cache.count >= CacheSize)
+                    cache.HandOver();
+            }
+
+            static ObjectPoolCounters& GetPoolCounters() { return s_counters; }
+
+        private:
+            static uint32 const COUNTER_FLUSH = 64;
+
+            struct FreeBlock
+            {
+                FreeBlock* next;
+            };
+
+            struct Batch
+            {
+                FreeBlock* head;
+                size_t count;
+            };
+
+            struct Depot
+            {
+                std::vector<Batch> batches;
+
+                ~Depot()
+                {
+                    for (Batch& batch : batches)
+                    {
+                        while (FreeBlock* block = batch.head)
+                        {
+                            batch.head = block->next;
+                            ::operator delete(block);
+                        }
+                    }
+                }
+            };
+
+            struct LocalCache
+            {
+                FreeBlock* head = nullptr;
+                size_t count = 0;
+                uint32 allocated = 0;
+                uint32 reused = 0;
+
+                ~LocalCache()
+                {
+                    FlushCounters();
+                    HandOver();                             // thread ends, keep its blocks for the others
+                }
+
+                void HandOver()
+                {
+                    if (!head)
+                        return;
+
+                    std::lock_guard<std::mutex> guard(s_depotLock);
+                    s_depot.batches.push_back({ head, count });
+                    s_depotSize.store(s_depot.batches.size(), std::memory_order_relaxed);
+                    head = nullptr;
+                    count = 0;
+                }
+
+                void FlushCounters()
+                {
+                    s_counters.allocated.fetch_add(allocated, std::memory_order_relaxed);
+                    s_counters.reused.fetch_add(reused, std::memory_order_relaxed);
+                    allocated = 0;
+                    reused = 0;
+                }
+            };
+
+            static LocalCache& GetLocalCache()
+            {
+                thread_local LocalCache cache;
+                return cache;
+            }
+
+            inline static std::mutex s_depotLock;
+            inline static Depot s_depot;
+            inline static std::atomic<size_t> s_depotSize{0};
+            inline static ObjectPoolCounters s_counters;
+    };
+}
+
+#endif
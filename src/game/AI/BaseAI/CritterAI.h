@@ -30,6 +30,7 @@ class CritterAI : public CreatureAI
 
         void EnterCombat(Unit* /*enemy*/) override;
         void UpdateAI(const uint32 /*diff*/) override;
+        bool CanSleepOutOfCombat() const override { return true; }
 
         static int Permissible(const Creature* creature);
     protected:
@@ -39,6 +39,7 @@ class GuardAI : public CreatureAI
         void MoveInLineOfSight(Unit* who) override;
 
         void UpdateAI(const uint32 diff) override;
+        bool CanSleepOutOfCombat() const override { return true; }
         static int Permissible(const Creature* creature);
     protected:
         std::string GetAIName() override { return "GuardAI"; }
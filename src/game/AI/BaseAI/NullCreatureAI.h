@@ -35,6 +35,7 @@ class NullCreatureAI : public CreatureAI
         bool IsVisible(Unit*) const override { return false;  }
 
         void UpdateAI(const uint32) override {}
+        bool CanSleepOutOfCombat() const override { return true; }
         static int Permissible(const Creature*) { return PERMIT_BASE_IDLE;  }
     protected:
         std::string GetAIName() override { return "NullAI"; }
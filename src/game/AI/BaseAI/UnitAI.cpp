@@ -553,6 +553,7 @@ void UnitAI::SendAIEventAround(AIEventType eventType, Unit* invoker, uint32 dela
         {
             AiDelayEventAround* e = new AiDelayEventAround(eventType, invoker ? invoker->GetObjectGuid() : ObjectGuid(), *m_unit, receiverList, miscValue);
             m_unit->m_events.AddEvent(e, m_unit->m_events.CalculateTime(delay));
+            m_unit->WakeUp();
         }
     }
 }
@@ -292,6 +292,13 @@ class UnitAI
          */
         virtual void UpdateAI(const uint32 /*diff*/) {}
 
+        /**
+         * Check if UpdateAI may be skipped while the creature is idle and out of combat
+         * Note: Only return true if the AI has no out of combat timers, as the skipped time is passed delayed.
+         *       An AI that stops allowing it at runtime must wake its creature with Unit::WakeUp()
+         */
+        virtual bool CanSleepOutOfCombat() const { return false; }
+
         ///== State checks =================================
 
         /**
@@ -97,6 +97,7 @@ CreatureEventAI::CreatureEventAI(Creature* creature) : CreatureAI(creature),
     m_depth(0),
     m_Phase(0),
     m_HasOOCLoSEvent(false),
+    m_HasOOCTimerEvent(false),
     m_InvinceabilityHpLevel(0),
     m_throwAIEventMask(0),
     m_throwAIEventStep(0),
@@ -180,6 +181,8 @@ void CreatureEventAI::InitAI()
                     // Cache for fast use
                     if (i.event_type == EVENT_T_OOC_LOS)
                         m_HasOOCLoSEvent = true;
+                    if (IsTimerExecutedEvent(EventAI_Type(i.event_type)) && !IsCombatOnlyTimerEvent(EventAI_Type(i.event_type)))
+                        m_HasOOCTimerEvent = true;
 
                     for (uint32 actionIdx = 0; actionIdx < MAX_ACTIONS; ++actionIdx)
                         if (i.action[actionIdx].type == ACTION_T_CAST)
@@ -245,6 +248,26 @@ bool CreatureEventAI::IsTimerExecutedEvent(EventAI_Type type) const
     }
 }
 
+// Timer executed events that need a victim and therefore never trigger while out of combat
+bool CreatureEventAI::IsCombatOnlyTimerEvent(EventAI_Type type) const
+{
+    switch (type)
+    {
+        case EVENT_T_TIMER_IN_COMBAT:
+        case EVENT_T_TARGET_HP:
+        case EVENT_T_TARGET_CASTING:
+        case EVENT_T_TARGET_MANA:
+        case EVENT_T_TARGET_AURA:
+        case EVENT_T_TARGET_MISSING_AURA:
+        case EVENT_T_RANGE:
+        case EVENT_T_SELECT_ATTACKING_TARGET:
+        case EVENT_T_FACING_TARGET:
+            return true;
+        default:
+            return false;
+    }
+}
+
 bool CreatureEventAI::IsRepeatableEvent(EventAI_Type type) const
 {
     switch (type)
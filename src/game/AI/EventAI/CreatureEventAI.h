@@ -840,6 +840,7 @@ class CreatureEventAI : public CreatureAI
         void JustPreventedDeath(Unit* attacker);
         void HealedBy(Unit* healer, uint32& healedAmount) override;
         void UpdateAI(const uint32 diff) override;
+        bool CanSleepOutOfCombat() const override { return !m_HasOOCTimerEvent; }
         void ReceiveEmote(Player* player, uint32 textEmote) override;
         void SummonedCreatureJustDied(Creature* summoned) override;
         void SummonedCreatureDespawn(Creature* summoned) override;
@@ -888,6 +889,7 @@ class CreatureEventAI : public CreatureAI
         bool IsTimerExecutedEvent(EventAI_Type type) const;
         bool IsRepeatableEvent(EventAI_Type type) const;
         bool IsTimerBasedEvent(EventAI_Type type) const;
+        bool IsCombatOnlyTimerEvent(EventAI_Type type) const;
         // Event rules specifiers end
         void DistanceYourself();
 
@@ -902,6 +904,7 @@ class CreatureEventAI : public CreatureAI
 
         uint8  m_Phase;                                     // Current phase, max 32 phases
         bool   m_HasOOCLoSEvent;                            // Cache if a OOC-LoS Event exists
+        bool   m_HasOOCTimerEvent;                          // Cache if a timer executed Event can trigger out of combat
         uint32 m_InvinceabilityHpLevel;                     // Minimal health level allowed at damage apply
 
         uint32 m_throwAIEventMask;                          // Automatically throw AIEvents that are encoded into this mask
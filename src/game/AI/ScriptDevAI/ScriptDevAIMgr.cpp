@@ -554,6 +554,22 @@ void ScriptDevAIMgr::LoadScriptNames()
     sLog.outString();
 }
 
+std::string ScriptDevAIMgr::GetScriptNamesKey() const
+{
+    // FNV-1a over all names, the terminating zero separates them
+    uint64 hash = uint64(14695981039346656037ULL);
+    for (auto const& name : m_scriptNames)
+    {
+        for (size_t i = 0; i <= name.size(); ++i)
+        {
+            hash ^= uint8(name.c_str()[i]);
+            hash *= uint64(1099511628211ULL);
+        }
+    }
+
+    return std::to_string(m_scriptNames.size()) + ':' + std::to_string(hash);
+}
+
 uint32 ScriptDevAIMgr::GetScriptId(const char* name) const
 {
     // use binary search to find the script name in the sorted vector
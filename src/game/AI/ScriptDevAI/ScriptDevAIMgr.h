@@ -168,6 +168,8 @@ class ScriptDevAIMgr
         const char* GetScriptName(uint32 id) const { return id < m_scriptNames.size() ? m_scriptNames[id].c_str() : ""; }
         uint32 GetScriptId(const char* name) const;
         uint32 GetScriptIdsCount() const { return m_scriptNames.size(); }
+        // identifies the loaded name to id mapping, tables storing script ids must not reuse snapshots made with another one
+        std::string GetScriptNamesKey() const;
 
         UnitAI* GetCreatureAI(Creature* pCreature) const;
         GameObjectAI* GetGameObjectAI(GameObject* gameobject) const;
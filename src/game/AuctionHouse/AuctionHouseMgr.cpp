@@ -485,10 +485,13 @@ bool AuctionHouseMgr::RemoveAItem(uint32 id)
     return true;
 }
 
-void AuctionHouseMgr::Update()
+bool AuctionHouseMgr::Update(TimeBudget const& budget)
 {
     for (auto& mAuction : mAuctions)
-        mAuction.Update();
+        if (!mAuction.Update(budget))
+            return false;
+
+    return true;
 }
 
 uint32 AuctionHouseMgr::GetAuctionHouseTeam(AuctionHouseEntry const* house)
@@ -569,7 +572,7 @@ AuctionHouseEntry const* AuctionHouseMgr::GetAuctionHouseEntry(Unit* unit)
     return sAuctionHouseStore.LookupEntry(houseid);
 }
 
-void AuctionHouseObject::Update()
+bool AuctionHouseObject::Update(TimeBudget const& budget)
 {
     time_t curTime = sWorld.GetGameTime();
     ///- Handle expired auctions
@@ -595,7 +598,13 @@ void AuctionHouseObject::Update()
             delete itr->second;
             AuctionsMap.erase(itr++);
         }
+
+        // rest is handled at next world tick
+        if (budget.Exceeded())
+            return false;
     }
+
+    return true;
 }
 
 void AuctionHouseObject::BuildListBidderItems(WorldPacket& data, Player* player, uint32 listfrom, uint32& count, uint32& totalcount)
@@ -21,6 +21,7 @@
 
 #include "Common.h"
 #include "Server/DBCStructure.h"
+#include "Timer.h"
 
 class Item;
 class Player;
@@ -119,7 +120,8 @@ class AuctionHouseObject
 
         bool RemoveAuction(uint32 id) { return !!AuctionsMap.erase(id); }
 
-        void Update();
+        // handle expired auctions, false if stopped by budget with expired auctions left
+        bool Update(TimeBudget const& budget);
 
         void BuildListBidderItems(WorldPacket& data, Player* player, uint32 listfrom, uint32& count, uint32& totalcount);
         void BuildListOwnerItems(WorldPacket& data, Player* player, uint32 listfrom, uint32& count, uint32& totalcount);
@@ -189,7 +191,7 @@ class AuctionHouseMgr
         void AddAItem(Item* it);
         bool RemoveAItem(uint32 id);
 
-        void Update();
+        bool Update(TimeBudget const& budget);
 
     private:
         AuctionHouseObject  mAuctions[MAX_AUCTION_HOUSE_TYPE];
@@ -117,9 +117,7 @@ void Channel::Join(Player* player, const char* password)
 
     data.clear();
 
-    PlayerInfo& pinfo = m_players[guid];
-    pinfo.player = guid;
-    pinfo.flags = MEMBER_FLAG_NONE;
+    AddMember(player);
 
     MakeYouJoined(data, m_name, *this);
     SendToOne(data, guid);
@@ -161,7 +159,7 @@ void Channel::Leave(Player* player, bool send)
 
     bool changeowner = m_players[guid].IsOwner();
 
-    m_players.erase(guid);
+    RemoveMember(guid);
 
     const uint32 level = sWorld.getConfig(CONFIG_UINT32_GM_LEVEL_CHANNEL_SILENT_JOIN);
     const bool silent = (level && player->GetSession()->GetSecurity() >= level);
@@ -242,7 +240,7 @@ void Channel::KickOrBan(Player* player, const char* targetName, bool ban)
         MakePlayerKicked(data, m_name, targetGuid, guid);
 
     SendToAll(data);
-    m_players.erase(targetGuid);
+    RemoveMember(targetGuid);
     target->LeftChannel(this);
 
     if (changeowner && !IsPublic())
@@ -518,7 +516,7 @@ void Channel::SendChannelListResponse(Player* player, bool display/*= false*/)
     uint32 count = 0;
     for (PlayerList::const_iterator i = m_players.begin(); i != m_players.end(); ++i)
     {
-        if (Player* member = sObjectMgr.GetPlayer(i->first))
+        if (Player* member = GetMember(i->second))
         {
             if (visibilityCheck && (member->GetSession()->GetSecurity() > visibilityThreshold || !member->IsVisibleGloballyFor(player)))
                 continue;
@@ -728,24 +726,64 @@ void Channel::Invite(Player* player, const char* targetName)
     SendToOne(data, guid);
 }
 
+void Channel::AddMember(Player* player)
+{
+    PlayerInfo& pinfo = m_players[player->GetObjectGuid()];
+    pinfo.player = player->GetObjectGuid();
+    pinfo.flags = MEMBER_FLAG_NONE;
+    pinfo.memberIndex = uint32(m_members.size());
+    m_members.push_back(player);
+}
+
+void Channel::RemoveMember(ObjectGuid guid)
+{
+    PlayerList::iterator itr = m_players.find(guid);
+    if (itr == m_players.end())
+        return;
+
+    // swap with the last member to keep m_members dense
+    uint32 index = itr->second.memberIndex;
+    if (index < m_members.size())
+    {
+        Player* last = m_members.back();
+        m_members[index] = last;
+        m_members.pop_back();
+        if (index < m_members.size())
+            m_players[last->GetObjectGuid()].memberIndex = index;
+    }
+
+    m_players.erase(itr);
+}
+
 void Channel::SendToOne(WorldPacket const& data, ObjectGuid receiver) const
 {
-    if (Player* player = sObjectMgr.GetPlayer(receiver))
+    // members are online by definition (channels are left on logout), skip the global lookup for them
+    PlayerList::const_iterator itr = m_players.find(receiver);
+    Player* player = itr != m_players.end() ? GetMember(itr->second) : nullptr;
+    if (!player)
+        player = sObjectMgr.GetPlayer(receiver);
+
+    if (player)
         player->GetSession()->SendPacket(data);
 }
 
 void Channel::SendToAll(WorldPacket const& data) const
 {
-    for (PlayerList::const_iterator i = m_players.begin(); i != m_players.end(); ++i)
-        SendToOne(data, i->first);
+    for (Player* member : m_members)
+        member->GetSession()->SendPacket(data);
 }
 
 void Channel::SendMessage(WorldPacket const& data, ObjectGuid sender) const
 {
-    for (PlayerList::const_iterator i = m_players.begin(); i != m_players.end(); ++i)
-        if (Player* plr = sObjectMgr.GetPlayer(i->first))
-            if (!sender || !plr->GetSocial()->HasIgnore(sender))
-                plr->GetSession()->SendPacket(data);
+    if (!sender)
+    {
+        SendToAll(data);
+        return;
+    }
+
+    for (Player* member : m_members)
+        if (!member->GetSocial()->HasIgnore(sender))
+            member->GetSession()->SendPacket(data);
 }
 
 void Channel::Voice(ObjectGuid /*guid1*/, ObjectGuid /*guid2*/) const
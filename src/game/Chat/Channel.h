@@ -25,6 +25,7 @@
 #include "Entities/Player.h"
 
 #include <map>
+#include <vector>
 
 enum ChatNotify : uint8
 {
@@ -119,6 +120,7 @@ class Channel
         {
             ObjectGuid player;
             uint8 flags;
+            uint32 memberIndex = UINT32_MAX;                // position in m_members, UINT32_MAX if not joined
 
             inline bool HasFlag(uint8 flag) const { return (flags & flag) != 0; }
             void SetFlag(uint8 flag, bool state) { if (state) flags |= flag; else flags &= ~flag; }
@@ -230,6 +232,10 @@ class Channel
 
         ObjectGuid SelectNewOwner() const;
 
+        void AddMember(Player* player);
+        void RemoveMember(ObjectGuid guid);
+        Player* GetMember(PlayerInfo const& info) const { return info.memberIndex < m_members.size() ? m_members[info.memberIndex] : nullptr; }
+
         void SetModeFlags(ObjectGuid guid, ChannelMemberFlags flags, bool set);
         void SetOwner(ObjectGuid guid, bool exclaim = true);
 
@@ -238,6 +244,8 @@ class Channel
         std::string                 m_password;
         ObjectGuid                  m_ownerGuid;
         PlayerList                  m_players;
+        // joined players, kept in sync with m_players on join/leave so fan-out needs no global player lookups
+        std::vector<Player*>        m_members;
         GuidSet                     m_banned;
         const ChatChannelsEntry*    m_entry = nullptr;
         bool                        m_announcements = false;
@@ -52,6 +52,7 @@
 #include "MotionGenerators/MoveMap.h"                       // for mmap manager
 #include "MotionGenerators/PathFinder.h"                    // for mmap commands
 #include "Movement/MoveSplineInit.h"
+#include "Entities/CharacterEnumCache.h"
 
 #include <fstream>
 #include <map>
@@ -3410,6 +3411,7 @@ bool ChatHandler::HandleCharacterRenameCommand(char* args)
         PSendSysMessage(LANG_RENAME_PLAYER, GetNameLink(target).c_str());
         target->SetAtLoginFlag(AT_LOGIN_RENAME);
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '1' WHERE guid = '%u'", target->GetGUIDLow());
+        sCharacterEnumCache.InvalidateCharacter(target->GetGUIDLow());
     }
     else
     {
@@ -3421,6 +3423,7 @@ bool ChatHandler::HandleCharacterRenameCommand(char* args)
 
         PSendSysMessage(LANG_RENAME_PLAYER_GUID, oldNameLink.c_str(), target_guid.GetCounter());
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '1' WHERE guid = '%u'", target_guid.GetCounter());
+        sCharacterEnumCache.InvalidateCharacter(target_guid.GetCounter());
     }
 
     return true;
@@ -56,6 +56,7 @@
 #include "Server/SQLStorages.h"
 #include "Loot/LootMgr.h"
 #include "World/WorldState.h"
+#include "Entities/CharacterEnumCache.h"
 
 #include "Custom/CPlayer.h"
 
@@ -3616,6 +3617,7 @@ void ChatHandler::HandleCharacterLevel(Player* player, ObjectGuid player_guid, u
     {
         // update level and XP at level, all other will be updated at loading
         CharacterDatabase.PExecute("UPDATE characters SET level = '%u', xp = 0 WHERE guid = '%u'", newlevel, player_guid.GetCounter());
+        sCharacterEnumCache.InvalidateCharacter(player_guid.GetCounter());
     }
 }
 
@@ -4272,6 +4274,7 @@ bool ChatHandler::HandleResetSpellsCommand(char* args)
     else
     {
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE guid = '%u'", uint32(AT_LOGIN_RESET_SPELLS), target_guid.GetCounter());
+        sCharacterEnumCache.InvalidateCharacter(target_guid.GetCounter());
         PSendSysMessage(LANG_RESET_SPELLS_OFFLINE, target_name.c_str());
     }
 
@@ -4299,6 +4302,7 @@ bool ChatHandler::HandleResetTalentsCommand(char* args)
     {
         uint32 at_flags = AT_LOGIN_RESET_TALENTS;
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE guid = '%u'", at_flags, target_guid.GetCounter());
+        sCharacterEnumCache.InvalidateCharacter(target_guid.GetCounter());
         std::string nameLink = playerLink(target_name);
         PSendSysMessage(LANG_RESET_TALENTS_OFFLINE, nameLink.c_str());
         return true;
@@ -4330,6 +4334,7 @@ bool ChatHandler::HandleResetTaxiNodesCommand(char* args)
     {
         uint32 at_flags = AT_LOGIN_RESET_TAXINODES;
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE guid = '%u'", at_flags, target_guid.GetCounter());
+        sCharacterEnumCache.InvalidateCharacter(target_guid.GetCounter());
         std::string nameLink = playerLink(target_name);
         PSendSysMessage("Taxi nodes of %s will be reset at next login.", nameLink.c_str());
         return true;
@@ -4372,6 +4377,7 @@ bool ChatHandler::HandleResetAllCommand(char* args)
     }
 
     CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE (at_login & '%u') = '0'", atLogin, atLogin);
+    sCharacterEnumCache.InvalidateAll();
     HashMapHolder<Player>::MapType const& plist = sObjectAccessor.GetPlayers();
     for (const auto& itr : plist)
         itr.second->SetAtLoginFlag(atLogin);
@@ -0,0 +1,46 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _THREATLISTRESORT
+#define _THREATLISTRESORT
+
+#include <iterator>
+
+// Insertion pass restoring the order of a nearly sorted list, cost grows with how far elements moved.
+// Stable like list::sort, so elements with equal priority keep their order, and elements are spliced
+// so no iterator is invalidated.
+template <class List, class HigherPriority>
+void ResortNearlySorted(List& list, HigherPriority higherPriority)
+{
+    if (list.empty())
+        return;
+
+    for (typename List::iterator itr = std::next(list.begin()); itr != list.end();)
+    {
+        typename List::iterator next = std::next(itr);
+        typename List::iterator pos = itr;
+        while (pos != list.begin() && higherPriority(*itr, *std::prev(pos)))
+            --pos;
+
+        if (pos != itr)
+            list.splice(pos, list, itr);
+        itr = next;
+    }
+}
+
+#endif
@@ -235,6 +235,25 @@ void ThreatContainer::clearReferences()
         delete (*i);
     }
     iThreatList.clear();
+    iRefIndex.clear();
+}
+
+//============================================================
+
+void ThreatContainer::addReference(HostileReference* hostileReference)
+{
+    iRefIndex[hostileReference->getUnitGuid()] = iThreatList.insert(iThreatList.end(), hostileReference);
+    iThreatChanged = true;                                  // new refs are appended, move them to their place
+}
+
+void ThreatContainer::remove(HostileReference* ref)
+{
+    auto itr = iRefIndex.find(ref->getUnitGuid());
+    if (itr == iRefIndex.end() || *itr->second != ref)
+        return;
+
+    iThreatList.erase(itr->second);
+    iRefIndex.erase(itr);
 }
 
 //============================================================
@@ -245,13 +264,8 @@ HostileReference* ThreatContainer::getReferenceByTarget(Unit* victim)
     if (!victim)
         return nullptr;
 
-    ObjectGuid guid = victim->GetObjectGuid();
-
-    for (ThreatList::const_iterator i = iThreatList.begin(); i != iThreatList.end(); ++i)
-        if ((*i)->getUnitGuid() == guid)
-            return (*i);
-
-    return nullptr;
+    auto itr = iRefIndex.find(victim->GetObjectGuid());
+    return itr != iRefIndex.end() ? *itr->second : nullptr;
 }
 
 //============================================================
@@ -304,9 +318,22 @@ void ThreatContainer::modifyAllThreatPercent(int32 threatPercent)
 //============================================================
 // Check if the list is dirty and sort if necessary
 
+bool ThreatContainer::isHigherPriority(HostileReference const* lhs, HostileReference const* rhs)
+{
+    if (lhs->GetTauntState() != rhs->GetTauntState())
+        return lhs->GetTauntState() > rhs->GetTauntState();
+    if (lhs->GetHostileState() != rhs->GetHostileState())
+        return lhs->GetHostileState() > rhs->GetHostileState();
+    return lhs->getThreat() > rhs->getThreat(); // reverse sorting
+}
+
+//============================================================
+
 void ThreatContainer::update(bool force, bool isPlayer)
 {
-    if ((iDirty || force || isPlayer) && iThreatList.size() > 1)
+    if (!iDirty && !force && !isPlayer && iThreatChanged && iThreatList.size() > 1)
+        ResortNearlySorted(iThreatList, &ThreatContainer::isHigherPriority);
+    else if ((iDirty || force || isPlayer) && iThreatList.size() > 1)
     {
         iThreatList.sort([&](const HostileReference* lhs, const HostileReference* rhs)->bool
         {
@@ -335,6 +362,7 @@ void ThreatContainer::update(bool force, bool isPlayer)
         });
     }
     iDirty = false;
+    iThreatChanged = false;
 }
 
 //============================================================
@@ -636,9 +664,8 @@ void ThreatManager::processThreatEvent(ThreatRefStatusChangeEvent& threatRefStat
     switch (threatRefStatusChangeEvent.getType())
     {
         case UEV_THREAT_REF_THREAT_CHANGE:
-            if ((getCurrentVictim() == hostileReference && threatRefStatusChangeEvent.getFValue() < 0.0f) ||
-                    (getCurrentVictim() != hostileReference && threatRefStatusChangeEvent.getFValue() > 0.0f))
-                setDirty(true);                             // the order in the threat list might have changed
+            if (hostileReference->isOnline())
+                iThreatContainer.setThreatChanged();        // the order in the threat list might have changed
             break;
         case UEV_THREAT_REF_ONLINE_STATUS:
             if (!hostileReference->isOnline())
@@ -24,7 +24,9 @@
 #include "Utilities/LinkedReference/Reference.h"
 #include "Entities/UnitEvents.h"
 #include "Entities/ObjectGuid.h"
+#include "Combat/ThreatListResort.h"
 #include <list>
+#include <unordered_map>
 
 //==============================================================
 
@@ -150,7 +152,7 @@ typedef std::list<HostileReference*> ThreatList;
 class ThreatContainer
 {
     public:
-        ThreatContainer() { iDirty = false; }
+        ThreatContainer() { iDirty = false; iThreatChanged = false; }
         ~ThreatContainer() { clearReferences(); }
 
         HostileReference* addThreat(Unit* victim, float threat);
@@ -164,6 +166,9 @@ class ThreatContainer
 
         bool isDirty() const { return iDirty; }
 
+        // only threat values changed, order is restored by moving the changed refs instead of a full sort
+        void setThreatChanged() { iThreatChanged = true; }
+
         bool empty() const { return iThreatList.empty(); }
 
         HostileReference* getMostHated() { return iThreatList.empty() ? nullptr : iThreatList.front(); }
@@ -174,15 +179,21 @@ class ThreatContainer
     protected:
         friend class ThreatManager;
 
-        void remove(HostileReference* ref) { iThreatList.remove(ref); }
-        void addReference(HostileReference* hostileReference) { iThreatList.push_back(hostileReference); }
+        void remove(HostileReference* ref);
+        void addReference(HostileReference* hostileReference);
         void clearReferences();
         // Sort the list if necessary
         void update(bool force, bool isPlayer);
 
         ThreatList iThreatList;
     private:
+        // taunt, then suppression, then threat - the order used when no position dependent rules apply
+        static bool isHigherPriority(HostileReference const* lhs, HostileReference const* rhs);
+
+        // list iterators stay valid on splice and sort, so refs are found and removed without a scan
+        std::unordered_map<ObjectGuid, ThreatList::iterator> iRefIndex;
         bool iDirty;
+        bool iThreatChanged;
 };
 
 //=================================================
@@ -1,11 +1,15 @@
 #include "AntiCheat.h"
-#include "Custom/CPlayer.h"
 #include "Entities/Unit.h"
 #include <memory>
 
-AntiCheat::AntiCheat(CPlayer* player)
+AntiCheat::AntiCheat(AntiCheatActions* actions)
 {
-    m_Player = player;
+    m_Actions = actions;
+    m_Initialized = false;
+    m_CanFly = false;
+    m_CanWaterwalk = false;
+    m_Knockback = false;
+    m_KnockbackSpeed = 0.f;
 
     newmoveInfo = MovementInfoPtr(new MovementInfo());
     oldmoveInfo = MovementInfoPtr(new MovementInfo());
@@ -15,14 +19,14 @@ AntiCheat::AntiCheat(CPlayer* player)
 bool AntiCheat::HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats)
 {
     newmoveInfo = MoveInfo;
-    newMapID = m_Player->GetMapId();
+    newMapID = m_State.mapId;
 
-    if (m_Player->HasAuraType(SPELL_AURA_FLY) || m_Player->HasAuraType(SPELL_AURA_MOD_FLIGHT_SPEED_MOUNTED) || m_Player->GetGMFly())
+    if (m_State.canFly)
         m_CanFly = true;
     else if (opcode == CMSG_MOVE_SET_CAN_FLY_ACK) // Trust that client will send ack when he's told not to fly anymore
         m_CanFly = false;
 
-    if (m_Player->HasAuraType(SPELL_AURA_WATER_WALK) || m_Player->HasAuraType(SPELL_AURA_GHOST))
+    if (m_State.waterWalk)
         m_CanWaterwalk = true;
     else if (opcode == CMSG_MOVE_WATER_WALK_ACK)
         m_CanWaterwalk = false;
@@ -38,7 +42,7 @@ bool AntiCheat::HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode,
 
 void AntiCheat::HandleRelocate(float x, float y, float z, float o)
 {
-    if (m_Player->IsTaxiFlying())
+    if (m_State.taxiFlying)
         oldmoveInfo->ChangePosition(x, y, z, o);
 }
 
@@ -68,14 +72,14 @@ void AntiCheat::HandleKnockBack(float /*angle*/, float horizontalSpeed, float ve
 
 bool AntiCheat::Initialized()
 {
-    if (!m_Initialized || m_Player->GetMapId() != oldMapID)
+    if (!m_Initialized || m_State.mapId != oldMapID)
     {
         m_Initialized = true;
         SetOldMoveInfo(false);
         SetStoredMoveInfo(false);
 
         for (uint8 i = 0; i < MAX_MOVE_TYPE; ++i)
-            AllowedSpeed.at(i) = m_Player->GetSpeed(UnitMoveType(i));
+            AllowedSpeed.at(i) = m_State.speeds[i];
 
         m_Falling = false;
         m_Jumping = false;
@@ -92,7 +96,7 @@ bool AntiCheat::Initialized()
 bool AntiCheat::SetOldMoveInfo(bool cheat)
 {
     oldmoveInfo = std::make_shared<MovementInfo>(*newmoveInfo);
-    oldMapID = m_Player->GetMapId();
+    oldMapID = m_State.mapId;
     OldServerSpeed = GetServerSpeed(false);
 
     return cheat;
@@ -101,7 +105,7 @@ bool AntiCheat::SetOldMoveInfo(bool cheat)
 bool AntiCheat::SetStoredMoveInfo(bool cheat)
 {
     storedmoveInfo = std::make_shared<MovementInfo>(*newmoveInfo);
-    storedMapID = m_Player->GetMapId();
+    storedMapID = m_State.mapId;
 
     return cheat;
 }
@@ -179,7 +183,7 @@ bool AntiCheat::isSwimming(const MovementInfoPtr& moveInfo)
 
 bool AntiCheat::isSwimming()
 {
-    return isSwimming(newmoveInfo) || isSwimming(oldmoveInfo) || m_Player->IsInWater();
+    return isSwimming(newmoveInfo) || isSwimming(oldmoveInfo) || m_State.inWater;
 }
 
 bool AntiCheat::verifyTransportCoords(const MovementInfoPtr& moveInfo)
@@ -388,7 +392,7 @@ void AntiCheat::UpdateGravityInfo(Opcodes opcode)
     if (m_InitialFallDiff == 0.f && falldiff != 0.f)
         m_InitialFallDiff = falldiff;
 
-    if (isFalling() && m_Player->HasAuraType(SPELL_AURA_FEATHER_FALL))
+    if (isFalling() && m_State.featherFall)
         m_SlowFall = true;
 }
 
@@ -397,33 +401,33 @@ void AntiCheat::UpdateSpeedInfo(Opcodes opcode)
     switch (opcode)
     {
     case CMSG_FORCE_WALK_SPEED_CHANGE_ACK:
-        AllowedSpeed.at(MOVE_WALK) = m_Player->GetSpeed(MOVE_WALK);
+        AllowedSpeed.at(MOVE_WALK) = m_State.speeds[MOVE_WALK];
         break;
     case CMSG_FORCE_RUN_SPEED_CHANGE_ACK:
-        AllowedSpeed.at(MOVE_RUN) = m_Player->GetSpeed(MOVE_RUN);
+        AllowedSpeed.at(MOVE_RUN) = m_State.speeds[MOVE_RUN];
         break;
     case CMSG_FORCE_RUN_BACK_SPEED_CHANGE_ACK:
-        AllowedSpeed.at(MOVE_RUN_BACK) = m_Player->GetSpeed(MOVE_RUN_BACK);
+        AllowedSpeed.at(MOVE_RUN_BACK) = m_State.speeds[MOVE_RUN_BACK];
         break;
     case CMSG_FORCE_SWIM_SPEED_CHANGE_ACK:
-        AllowedSpeed.at(MOVE_SWIM) = m_Player->GetSpeed(MOVE_SWIM);
+        AllowedSpeed.at(MOVE_SWIM) = m_State.speeds[MOVE_SWIM];
         break;
     case CMSG_FORCE_SWIM_BACK_SPEED_CHANGE_ACK:
-        AllowedSpeed.at(MOVE_SWIM_BACK) = m_Player->GetSpeed(MOVE_SWIM_BACK);
+        AllowedSpeed.at(MOVE_SWIM_BACK) = m_State.speeds[MOVE_SWIM_BACK];
         break;
     case CMSG_FORCE_TURN_RATE_CHANGE_ACK:
-        AllowedSpeed.at(MOVE_TURN_RATE) = m_Player->GetSpeed(MOVE_TURN_RATE);
+        AllowedSpeed.at(MOVE_TURN_RATE) = m_State.speeds[MOVE_TURN_RATE];
         break;
     case CMSG_FORCE_FLIGHT_SPEED_CHANGE_ACK:
-        AllowedSpeed.at(MOVE_FLIGHT) = m_Player->GetSpeed(MOVE_FLIGHT);
+        AllowedSpeed.at(MOVE_FLIGHT) = m_State.speeds[MOVE_FLIGHT];
         break;
     case CMSG_FORCE_FLIGHT_BACK_SPEED_CHANGE_ACK:
-        AllowedSpeed.at(MOVE_FLIGHT_BACK) = m_Player->GetSpeed(MOVE_FLIGHT_BACK);
+        AllowedSpeed.at(MOVE_FLIGHT_BACK) = m_State.speeds[MOVE_FLIGHT_BACK];
         break;
     default: break;
     }
 
     for (uint8 i = 0; i < MAX_MOVE_TYPE; ++i)
-        if (m_Player->GetSpeed(UnitMoveType(i)) > AllowedSpeed.at(UnitMoveType(i)))
-            AllowedSpeed.at(UnitMoveType(i)) = m_Player->GetSpeed(UnitMoveType(i));
+        if (m_State.speeds[i] > AllowedSpeed.at(UnitMoveType(i)))
+            AllowedSpeed.at(UnitMoveType(i)) = m_State.speeds[i];
 }
@@ -5,6 +5,7 @@
 
 #include <type_traits>
 #include <bitset>
+#include <ostream>
 
 #define JUMPHEIGHT_LAND 1.65f
 #define JUMPHEIGHT_WATER 2.15f
@@ -27,14 +28,64 @@ enum AntiCheatFieldOffsets : std::size_t {
   CHEAT_MAX,
 };
 
-class CPlayer;
+enum AntiCheatEventType : uint8
+{
+    ANTICHEAT_EVENT_MOVEMENT,
+    ANTICHEAT_EVENT_RELOCATE,
+    ANTICHEAT_EVENT_TELEPORT,
+    ANTICHEAT_EVENT_KNOCKBACK,
+};
 
 typedef std::bitset<AntiCheatFieldOffsets::CHEAT_MAX> AntiCheatFields;
 
+// Player state the checks depend on, taken when the event happened as it may have changed until validation
+struct AntiCheatPlayerState
+{
+    uint32 mapId = 0;                               // map the player was on, the checks teleport back on it
+    float x = 0.f, y = 0.f, z = 0.f;                // server side position
+    bool alive = false;
+    bool inWater = false;
+    bool taxiFlying = false;
+    bool canFly = false;                            // fly auras or gm fly
+    bool waterWalk = false;                         // water walk or ghost auras
+    bool featherFall = false;
+    uint32 latency = 0;
+    std::array<float, MAX_MOVE_TYPE> speeds = {};
+};
+
+// Input of the checks, queued by the player in the order it happened and validated at its next update
+struct AntiCheatEvent
+{
+    explicit AntiCheatEvent(AntiCheatEventType type) : type(type) {}
+
+    AntiCheatEventType type;
+    AntiCheatPlayerState state;
+    Opcodes opcode = MSG_NULL_ACTION;
+    uint32 mapId = 0;
+    MovementInfoPtr moveInfo;                       // copy, the received one is changed when the movement gets applied
+    float x = 0.f, y = 0.f, z = 0.f, o = 0.f;       // relocate and teleport destination
+    float angle = 0.f, horizontalSpeed = 0.f, verticalSpeed = 0.f;
+};
+
+// What the checks do to the player on a detection, implemented by CPlayer and by the replay of recorded movement
+class AntiCheatActions
+{
+public:
+    virtual ~AntiCheatActions() {}
+
+    virtual bool ShowCheatDetails() const = 0;      // gm accounts get the detection details in the box chat
+    virtual std::ostream& GetBoxChat() = 0;
+    virtual void TeleportBack(uint32 mapId, Position const* pos) = 0;
+    virtual void DisableFly() = 0;
+    virtual void DisableWaterWalk() = 0;
+    virtual float GetStaticHeight(float x, float y, float z) const = 0;
+    virtual void KillFallToVoid() = 0;
+};
+
 class AntiCheat
 {
 public:
-    AntiCheat(CPlayer* player);
+    AntiCheat(AntiCheatActions* actions);
     virtual ~AntiCheat() {}
 
     virtual bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats);
@@ -43,6 +94,11 @@ public:
     virtual void HandleTeleport(uint32 map, float x, float y, float z, float o);
     virtual void HandleKnockBack(float angle, float horizontalSpeed, float verticalSpeed);
 
+    AntiCheatFieldOffsets GetCheatType() const { return antiCheatFieldOffset; }
+
+    // state of the player when the next handled event happened
+    void SetPlayerState(AntiCheatPlayerState const& state) { m_State = state; }
+
 protected:
     bool Initialized();
     bool SetOldMoveInfo(bool cheat = false);
@@ -100,7 +156,8 @@ protected:
     float GetFallDistance() { return m_StartFallZ - newmoveInfo->GetPos()->z; }
 
 protected:
-    CPlayer* m_Player;
+    AntiCheatActions* m_Actions;
+    AntiCheatPlayerState m_State;
     MovementInfoPtr newmoveInfo;
     MovementInfoPtr oldmoveInfo;
     MovementInfoPtr storedmoveInfo;
@@ -0,0 +1,98 @@
+#include "AntiCheatRecorder.h"
+#include "Custom/CPlayer.h"
+#include "Log.h"
+#include "Metric/Metric.h"
+
+AntiCheatRecorder::~AntiCheatRecorder()
+{
+    Open("");
+}
+
+void AntiCheatRecorder::Open(std::string const& fileName)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    if (m_file)
+    {
+        fclose(m_file);
+        m_file = nullptr;
+    }
+
+    if (!fileName.empty())
+    {
+        m_file = fopen(fileName.c_str(), "a");
+        if (m_file)
+        {
+            // M time guid map opcode moveflags clienttime actime x y z o tx ty tz falltime jumpvelocity jumpsin jumpcos jumpxyspeed
+            //   canfly waterwalk inwater featherfall latency speeds[MAX_MOVE_TYPE] detected
+            // R/T time guid map x y z o, K time guid map angle horizontalspeed verticalspeed
+            fprintf(m_file, "# anticheat record v1\n");
+        }
+        else
+            sLog.outError("AntiCheatRecorder: can't open %s for writing, movement is not recorded", fileName.c_str());
+    }
+
+    m_recording = m_file != nullptr;
+}
+
+void AntiCheatRecorder::Record(CPlayer* player, AntiCheatEvent const& event, AntiCheatFields const& detected)
+{
+    char line[512];
+    int length = 0;
+    uint32 now = WorldTimer::getMSTime();
+    uint32 guid = player->GetGUIDLow();
+
+    switch (event.type)
+    {
+        case ANTICHEAT_EVENT_MOVEMENT:
+        {
+            MovementInfo const& moveInfo = *event.moveInfo;
+            Position const* pos = moveInfo.GetPos();
+            Position const* tpos = moveInfo.GetTransportPos();
+            MovementInfo::JumpInfo const& jump = moveInfo.GetJumpInfo();
+
+            length = snprintf(line, sizeof(line), "M %u %u %u %u %u %u %u %.3f %.3f %.3f %.3f %.3f %.3f %.3f %u %.3f %.3f %.3f %.3f %u %u %u %u %u",
+                now, guid, event.state.mapId, uint32(event.opcode), uint32(moveInfo.GetMovementFlags()), moveInfo.GetTime(), moveInfo.GetACTime(),
+                pos->x, pos->y, pos->z, pos->o, tpos->x, tpos->y, tpos->z, moveInfo.GetFallTime(),
+                jump.velocity, jump.sinAngle, jump.cosAngle, jump.xyspeed,
+                uint32(event.state.canFly), uint32(event.state.waterWalk), uint32(event.state.inWater), uint32(event.state.featherFall), event.state.latency);
+
+            for (uint8 i = 0; i < MAX_MOVE_TYPE && length < int(sizeof(line)); ++i)
+                length += snprintf(line + length, sizeof(line) - length, " %.3f", event.state.speeds[i]);
+
+            if (length < int(sizeof(line)))
+                length += snprintf(line + length, sizeof(line) - length, " %lu\n", detected.to_ulong());
+            break;
+        }
+        case ANTICHEAT_EVENT_RELOCATE:
+        case ANTICHEAT_EVENT_TELEPORT:
+            length = snprintf(line, sizeof(line), "%c %u %u %u %.3f %.3f %.3f %.3f\n", event.type == ANTICHEAT_EVENT_RELOCATE ? 'R' : 'T',
+                now, guid, event.mapId, event.x, event.y, event.z, event.o);
+            break;
+        case ANTICHEAT_EVENT_KNOCKBACK:
+            length = snprintf(line, sizeof(line), "K %u %u %u %.3f %.3f %.3f\n", now, guid, event.mapId, event.angle, event.horizontalSpeed, event.verticalSpeed);
+            break;
+    }
+
+    if (length <= 0 || length >= int(sizeof(line)))
+        return;
+
+    std::lock_guard<std::mutex> guard(m_lock);
+    if (m_file)
+        fwrite(line, 1, length, m_file);
+}
+
+void AntiCheatRecorder::AddValidation(uint32 events, uint32 detected, uint64 microseconds)
+{
+    m_validated.fetch_add(events, std::memory_order_relaxed);
+    m_detected.fetch_add(detected, std::memory_order_relaxed);
+    m_validateTime.fetch_add(microseconds, std::memory_order_relaxed);
+}
+
+void AntiCheatRecorder::GenerateMetrics()
+{
+    metric::measurement meas("world.metrics.anticheat");
+    meas.add_field("validated", std::to_string(m_validated.exchange(0)));
+    meas.add_field("detected", std::to_string(m_detected.exchange(0)));
+    meas.add_field("time_us", std::to_string(m_validateTime.exchange(0)));
+}
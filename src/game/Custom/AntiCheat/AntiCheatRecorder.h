@@ -0,0 +1,37 @@
+#pragma once
+
+#include "AntiCheat.h"
+#include "Custom/Singleton.h"
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <string>
+
+class CPlayer;
+
+// Writes the events validated by the anticheat to a file, together with the player state the checks look at,
+// so real movement can be studied and replayed outside of the server. Also counts the validation cost for the metrics.
+class AntiCheatRecorder : public CSingleton<AntiCheatRecorder>
+{
+public:
+    ~AntiCheatRecorder();
+
+    void Open(std::string const& fileName);         // empty file name stops recording
+    bool IsOpen() const { return m_recording; }
+    void Record(CPlayer* player, AntiCheatEvent const& event, AntiCheatFields const& detected);
+
+    void AddValidation(uint32 events, uint32 detected, uint64 microseconds);
+    void GenerateMetrics();
+
+private:
+    std::mutex m_lock;
+    FILE* m_file = nullptr;
+    std::atomic<bool> m_recording{false};
+
+    std::atomic<uint64> m_validated{0};
+    std::atomic<uint64> m_detected{0};
+    std::atomic<uint64> m_validateTime{0};
+};
+
+#define sAntiCheatRecorder AntiCheatRecorder::Instance()
@@ -1,8 +1,7 @@
 #include "AntiCheat_fly.h"
 #include "Custom/AntiCheat/AntiCheat.h"
-#include "Custom/CPlayer.h"
 
-AntiCheat_fly::AntiCheat_fly(CPlayer* player) : AntiCheat(player)
+AntiCheat_fly::AntiCheat_fly(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_FLY;
 }
@@ -16,10 +15,10 @@ bool AntiCheat_fly::HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opco
 
     if (isFlying(MoveInfo) && !CanFly())
     {
-        if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
-            m_Player->BoxChat << "FLY CHEAT" << "\n";
+        if (m_Actions->ShowCheatDetails())
+            m_Actions->GetBoxChat() << "FLY CHEAT" << "\n";
 
-        m_Player->SetCanFly(false);
+        m_Actions->DisableFly();
 
         return true;
     }
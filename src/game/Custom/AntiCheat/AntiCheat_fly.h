@@ -5,7 +5,7 @@
 class AntiCheat_fly : public AntiCheat
 {
 public:
-    AntiCheat_fly(CPlayer* player);
+    AntiCheat_fly(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
 };
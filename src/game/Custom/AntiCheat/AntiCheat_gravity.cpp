@@ -1,10 +1,9 @@
 #include "AntiCheat_gravity.h"
 #include "Custom/AntiCheat/AntiCheat.h"
-#include "Custom/CPlayer.h"
 
 #include <iomanip>
 
-AntiCheat_gravity::AntiCheat_gravity(CPlayer* player) : AntiCheat(player)
+AntiCheat_gravity::AntiCheat_gravity(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_GRAVITY;
 }
@@ -26,17 +25,17 @@ bool AntiCheat_gravity::HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes
 
     if (triggeredcheats.none() && isFalling() && diff > GetFallDistance() * 0.01f && diff > 0.01f)
     {
-        m_Player->TeleportToPos(storedMapID, storedmoveInfo->GetPos(), TELE_TO_NOT_LEAVE_COMBAT);
+        m_Actions->TeleportBack(storedMapID, storedmoveInfo->GetPos());
 
-        if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
+        if (m_Actions->ShowCheatDetails())
         {
-            m_Player->BoxChat << "Gravity hack" << "\n";
-            m_Player->BoxChat << std::fixed << "diff:" << diff << std::endl;
-            m_Player->BoxChat << "currentz: " << newmoveInfo->GetPos()->z << std::endl;
-            m_Player->BoxChat << "expectedz: " << GetExpectedZ(newmoveInfo->GetFallTime()) << std::endl;
-            m_Player->BoxChat << "velocityZ: " << GetDistanceZ() / GetDiffInSec() << std::endl;
-            m_Player->BoxChat << "falltime: " << newmoveInfo->GetFallTime() << std::endl;
-            m_Player->BoxChat << "falldistance: " << GetFallDistance() << std::endl;
+            m_Actions->GetBoxChat() << "Gravity hack" << "\n";
+            m_Actions->GetBoxChat() << std::fixed << "diff:" << diff << std::endl;
+            m_Actions->GetBoxChat() << "currentz: " << newmoveInfo->GetPos()->z << std::endl;
+            m_Actions->GetBoxChat() << "expectedz: " << GetExpectedZ(newmoveInfo->GetFallTime()) << std::endl;
+            m_Actions->GetBoxChat() << "velocityZ: " << GetDistanceZ() / GetDiffInSec() << std::endl;
+            m_Actions->GetBoxChat() << "falltime: " << newmoveInfo->GetFallTime() << std::endl;
+            m_Actions->GetBoxChat() << "falldistance: " << GetFallDistance() << std::endl;
         }
     }
 
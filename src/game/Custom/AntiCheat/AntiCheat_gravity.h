@@ -5,7 +5,7 @@
 class AntiCheat_gravity : public AntiCheat
 {
 public:
-    AntiCheat_gravity(CPlayer* player);
+    AntiCheat_gravity(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
 
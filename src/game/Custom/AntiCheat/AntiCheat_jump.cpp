@@ -1,8 +1,7 @@
 #include "AntiCheat_jump.h"
 #include "Custom/AntiCheat/AntiCheat.h"
-#include "Custom/CPlayer.h"
 
-AntiCheat_jump::AntiCheat_jump(CPlayer* player) : AntiCheat(player)
+AntiCheat_jump::AntiCheat_jump(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_JUMP;
 }
@@ -16,10 +15,10 @@ bool AntiCheat_jump::HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opc
 
     if (triggeredcheats.none() && opcode == MSG_MOVE_JUMP && isFalling(oldmoveInfo))
     {
-		m_Player->TeleportToPos(storedMapID, storedmoveInfo->GetPos(), TELE_TO_NOT_LEAVE_COMBAT);
+		m_Actions->TeleportBack(storedMapID, storedmoveInfo->GetPos());
 
-        if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
-            m_Player->BoxChat << "Jump hack" << "\n";
+        if (m_Actions->ShowCheatDetails())
+            m_Actions->GetBoxChat() << "Jump hack" << "\n";
 
         return SetOldMoveInfo(true);
     }
@@ -5,7 +5,7 @@
 class AntiCheat_jump : public AntiCheat
 {
 public:
-    AntiCheat_jump(CPlayer* player);
+    AntiCheat_jump(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
 };
@@ -1,8 +1,6 @@
 #include "AntiCheat_nofall.h"
-#include "Custom/CPlayer.h"
-#include "World/World.h"
 
-AntiCheat_nofall::AntiCheat_nofall(CPlayer* player) : AntiCheat(player)
+AntiCheat_nofall::AntiCheat_nofall(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_NOFALL;
 }
@@ -16,10 +14,10 @@ bool AntiCheat_nofall::HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes o
 
     if (newmoveInfo->HasMovementFlag(MOVEFLAG_LEVITATING) && !CanFly())
     {
-        if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
-            m_Player->BoxChat << "NOFALL CHEAT" << "\n";
+        if (m_Actions->ShowCheatDetails())
+            m_Actions->GetBoxChat() << "NOFALL CHEAT" << "\n";
 
-		m_Player->TeleportToPos(oldMapID, oldmoveInfo->GetPos(), TELE_TO_NOT_LEAVE_COMBAT);
+		m_Actions->TeleportBack(oldMapID, oldmoveInfo->GetPos());
 
         return true;
     }
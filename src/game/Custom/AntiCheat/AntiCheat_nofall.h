@@ -5,7 +5,7 @@
 class AntiCheat_nofall : public AntiCheat
 {
 public:
-    AntiCheat_nofall(CPlayer* player);
+    AntiCheat_nofall(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
 };
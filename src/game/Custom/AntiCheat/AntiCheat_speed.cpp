@@ -1,13 +1,9 @@
 #include "AntiCheat_speed.h"
 #include "Custom/AntiCheat/AntiCheat.h"
-#include "Custom/CPlayer.h"
-#include "World/World.h"
-#include "Maps/Map.h"
-#include "Maps/MapManager.h"
 
 #include <iomanip>
 
-AntiCheat_speed::AntiCheat_speed(CPlayer* player) : AntiCheat(player)
+AntiCheat_speed::AntiCheat_speed(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_SPEED;
 }
@@ -51,18 +47,18 @@ bool AntiCheat_speed::HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes op
 
     if (triggeredcheats.none() && cheating)
     {
-        if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
+        if (m_Actions->ShowCheatDetails())
         {
-            m_Player->BoxChat << "----------------------------" << "\n";
-            m_Player->BoxChat << "xyspeed: " << newmoveInfo->GetJumpInfo().xyspeed << "\n";
-            m_Player->BoxChat << "velocity: " << newmoveInfo->GetJumpInfo().velocity << "\n";
-            m_Player->BoxChat << std::setprecision(10) << "allowedspeed: " << allowedspeed << "\n";
-            m_Player->BoxChat << std::setprecision(10) << "travelspeed: " << travelspeed << "\n";
-            m_Player->BoxChat << std::setprecision(10) << "diff: " << travelspeed - allowedspeed << "\n";
-            m_Player->BoxChat << "SPEEDCHEAT" << "\n";
+            m_Actions->GetBoxChat() << "----------------------------" << "\n";
+            m_Actions->GetBoxChat() << "xyspeed: " << newmoveInfo->GetJumpInfo().xyspeed << "\n";
+            m_Actions->GetBoxChat() << "velocity: " << newmoveInfo->GetJumpInfo().velocity << "\n";
+            m_Actions->GetBoxChat() << std::setprecision(10) << "allowedspeed: " << allowedspeed << "\n";
+            m_Actions->GetBoxChat() << std::setprecision(10) << "travelspeed: " << travelspeed << "\n";
+            m_Actions->GetBoxChat() << std::setprecision(10) << "diff: " << travelspeed - allowedspeed << "\n";
+            m_Actions->GetBoxChat() << "SPEEDCHEAT" << "\n";
         }
 
-		m_Player->TeleportToPos(storedMapID, storedmoveInfo->GetPos(), TELE_TO_NOT_LEAVE_COMBAT);
+		m_Actions->TeleportBack(storedMapID, storedmoveInfo->GetPos());
 
         return SetOldMoveInfo(true);
     }
@@ -5,7 +5,7 @@
 class AntiCheat_speed : public AntiCheat
 {
 public:
-    AntiCheat_speed(CPlayer* player);
+    AntiCheat_speed(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
 
@@ -1,8 +1,7 @@
 #include "AntiCheat_teleport.h"
 #include "Custom/AntiCheat/AntiCheat.h"
-#include "Custom/CPlayer.h"
 
-AntiCheat_teleport::AntiCheat_teleport(CPlayer* player) : AntiCheat(player)
+AntiCheat_teleport::AntiCheat_teleport(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_TELEPORT;
 }
@@ -22,10 +21,10 @@ bool AntiCheat_teleport::HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes
     {
         if (!IsMoving(oldmoveInfo) && GetDistOrTransportDist(true) > 0.1f && (!isFalling() || opcode == MSG_MOVE_JUMP))
         {
-			m_Player->TeleportToPos(oldMapID, oldmoveInfo->GetPos(), TELE_TO_NOT_LEAVE_COMBAT);
+			m_Actions->TeleportBack(oldMapID, oldmoveInfo->GetPos());
 
-            if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
-                m_Player->BoxChat << "TELE CHEAT" << "\n";
+            if (m_Actions->ShowCheatDetails())
+                m_Actions->GetBoxChat() << "TELE CHEAT" << "\n";
 
             return SetOldMoveInfo(true);
         }
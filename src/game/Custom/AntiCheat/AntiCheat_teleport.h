@@ -5,7 +5,7 @@
 class AntiCheat_teleport : public AntiCheat
 {
 public:
-    AntiCheat_teleport(CPlayer* player);
+    AntiCheat_teleport(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
     void HandleKnockBack(float angle, float horizontalSpeed, float verticalSpeed) override;
@@ -5,7 +5,7 @@
 class AntiCheat_test : public AntiCheat
 {
 public:
-    AntiCheat_test(CPlayer* player);
+    AntiCheat_test(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
 };
@@ -1,12 +1,8 @@
 #include <numeric>
 
 #include "AntiCheat_time.h"
-#include "Entities/Unit.h"
-#include "World/World.h"
-#include "Custom/CPlayer.h"
-#include "Entities/Transports.h"
 
-AntiCheat_time::AntiCheat_time(CPlayer* player) : AntiCheat(player)
+AntiCheat_time::AntiCheat_time(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_TIME;
     calculatedServerTime = 0;
@@ -27,16 +23,16 @@ bool AntiCheat_time::HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opc
 
     int diff = MoveInfo->GetTime() - calculatedServerTime;
 
-    if (std::abs(diff) > 1000 + m_Player->GetSession()->GetLatency())
+    if (std::abs(diff) > 1000 + m_State.latency)
     {
-        m_Player->TeleportToPos(oldMapID, oldmoveInfo->GetPos(), TELE_TO_NOT_LEAVE_COMBAT);
+        m_Actions->TeleportBack(oldMapID, oldmoveInfo->GetPos());
 
-        if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
+        if (m_Actions->ShowCheatDetails())
         {
-            m_Player->BoxChat << "TIMECHEAT" << "\n";
-            m_Player->BoxChat << "ClientTime: " << MoveInfo->GetTime() << "\n";
-            m_Player->BoxChat << "ServerTime: " << WorldTimer::getMSTime() << "\n";
-            m_Player->BoxChat << "Offset: " << diff << "\n";
+            m_Actions->GetBoxChat() << "TIMECHEAT" << "\n";
+            m_Actions->GetBoxChat() << "ClientTime: " << MoveInfo->GetTime() << "\n";
+            m_Actions->GetBoxChat() << "ServerTime: " << calculatedServerTime << "\n";
+            m_Actions->GetBoxChat() << "Offset: " << diff << "\n";
         }
 
         // Reset time offset when cheat is detected
@@ -5,7 +5,7 @@
 class AntiCheat_time : public AntiCheat
 {
 public:
-    AntiCheat_time(CPlayer* player);
+    AntiCheat_time(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
     void HandleUpdate(uint32 updatediffms) override;
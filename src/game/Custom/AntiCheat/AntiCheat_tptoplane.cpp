@@ -1,7 +1,6 @@
 #include "AntiCheat_tptoplane.h"
-#include "Custom/CPlayer.h"
 
-AntiCheat_tptoplane::AntiCheat_tptoplane(CPlayer* player) : AntiCheat(player)
+AntiCheat_tptoplane::AntiCheat_tptoplane(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_TPTOPLANE;
 }
@@ -16,22 +15,22 @@ bool AntiCheat_tptoplane::HandleMovement(const MovementInfoPtr& MoveInfo, Opcode
     const Position* pn = newmoveInfo->GetPos();
     const Position* po = oldmoveInfo->GetPos();
 
-    if (!m_Player->IsAlive())
+    if (!m_State.alive)
         return SetOldMoveInfo(false);
 
     if (std::fabs(po->z) <= 0.0001f && std::fabs(pn->z) <= 0.0001f &&
         std::fabs(po->z - pn->z) < 0.0001f)
     {
-        auto groundz = m_Player->GetTerrain()->GetHeightStatic(pn->x, pn->y, pn->y, true);
+        auto groundz = m_Actions->GetStaticHeight(pn->x, pn->y, pn->y);
         // If we're walking really fucking close to 0 and the ground isn't very close to 0 we've found a cheater
         if (std::fabs(groundz - pn->z) > 2.f)
         {
-            if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
-                m_Player->BoxChat << "TELEPORT TO PLANE CHEAT" << "\n";
+            if (m_Actions->ShowCheatDetails())
+                m_Actions->GetBoxChat() << "TELEPORT TO PLANE CHEAT" << "\n";
 
             // Since tptoplane cheats forces the player back to 0.f again
             // The only protection is to kill them and hope they've learned their lesson
-            m_Player->EnvironmentalDamage(DAMAGE_FALL_TO_VOID, m_Player->GetHealth());
+            m_Actions->KillFallToVoid();
         }
     }
 
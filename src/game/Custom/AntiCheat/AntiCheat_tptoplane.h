@@ -5,7 +5,7 @@
 class AntiCheat_tptoplane : public AntiCheat
 {
 public:
-    AntiCheat_tptoplane(CPlayer* player);
+    AntiCheat_tptoplane(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
 };
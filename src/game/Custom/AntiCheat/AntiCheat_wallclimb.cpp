@@ -1,9 +1,8 @@
 #include "AntiCheat_wallclimb.h"
 #include "Custom/AntiCheat/AntiCheat.h"
-#include "Custom/CPlayer.h"
 #include "Server/Opcodes.h"
 
-AntiCheat_wallclimb::AntiCheat_wallclimb(CPlayer* player) : AntiCheat(player)
+AntiCheat_wallclimb::AntiCheat_wallclimb(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_WALLCLIMB;
 }
@@ -27,16 +26,16 @@ bool AntiCheat_wallclimb::HandleMovement(const MovementInfoPtr& MoveInfo, Opcode
         return false;
 
     float angle = std::atan2(GetDistanceZ(), GetDistance2D()) * 180.f / M_PI_F;
-    m_Player->BoxChat << "angle: " << angle << "\n";
-    m_Player->BoxChat << "distance3d: " << GetDistance3D() << "\n";
-    m_Player->BoxChat << "distancez: " << GetDistanceZ() << "\n";
+    m_Actions->GetBoxChat() << "angle: " << angle << "\n";
+    m_Actions->GetBoxChat() << "distance3d: " << GetDistance3D() << "\n";
+    m_Actions->GetBoxChat() << "distancez: " << GetDistanceZ() << "\n";
 
     if (triggeredcheats.none() && angle > 50.f)
     {
-		m_Player->TeleportToPos(storedMapID, storedmoveInfo->GetPos(), TELE_TO_NOT_LEAVE_COMBAT);
+		m_Actions->TeleportBack(storedMapID, storedmoveInfo->GetPos());
 
-        if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
-            m_Player->BoxChat << "Wallclimbing angle: " << angle << "\n";
+        if (m_Actions->ShowCheatDetails())
+            m_Actions->GetBoxChat() << "Wallclimbing angle: " << angle << "\n";
 
         return SetOldMoveInfo(true);
     }
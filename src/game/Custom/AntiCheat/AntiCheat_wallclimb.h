@@ -5,7 +5,7 @@
 class AntiCheat_wallclimb : public AntiCheat
 {
 public:
-    AntiCheat_wallclimb(CPlayer* player);
+    AntiCheat_wallclimb(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
 private:
@@ -1,9 +1,8 @@
 #include "AntiCheat_walljump.h"
 #include "Custom/AntiCheat/AntiCheat.h"
-#include "Custom/CPlayer.h"
 #include <algorithm>
 
-AntiCheat_walljump::AntiCheat_walljump(CPlayer* player) : AntiCheat(player)
+AntiCheat_walljump::AntiCheat_walljump(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_WALLJUMP;
     AboveAngleCount = 0;
@@ -26,10 +25,10 @@ bool AntiCheat_walljump::HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes
         {
             if (triggeredcheats.none() && !isFlying() && !isSwimming() && AboveAngleCount)
             {
-				m_Player->TeleportToPos(storedMapID, storedmoveInfo->GetPos(), TELE_TO_NOT_LEAVE_COMBAT);
+				m_Actions->TeleportBack(storedMapID, storedmoveInfo->GetPos());
 
-                if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
-                    m_Player->BoxChat << "Jumpclimbing angle: " << angle << "\n";
+                if (m_Actions->ShowCheatDetails())
+                    m_Actions->GetBoxChat() << "Jumpclimbing angle: " << angle << "\n";
 
                 triggeredcheats.set(AntiCheatFieldOffsets::CHEAT_WALLJUMP);
             }
@@ -5,7 +5,7 @@
 class AntiCheat_walljump : public AntiCheat
 {
 public:
-    AntiCheat_walljump(CPlayer* player);
+    AntiCheat_walljump(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
 private:
@@ -1,10 +1,6 @@
 #include "AntiCheat_waterwalking.h"
-#include "Custom/CPlayer.h"
-#include "Spells/Spell.h"
-#include "Spells/SpellAuras.h"
-#include "Spells/SpellMgr.h"
 
-AntiCheat_waterwalking::AntiCheat_waterwalking(CPlayer* player) : AntiCheat(player)
+AntiCheat_waterwalking::AntiCheat_waterwalking(AntiCheatActions* actions) : AntiCheat(actions)
 {
     antiCheatFieldOffset = AntiCheatFieldOffsets::CHEAT_WATERWALK;
 }
@@ -18,13 +14,13 @@ bool AntiCheat_waterwalking::HandleMovement(const MovementInfoPtr& MoveInfo, Opc
 
     if (!CanWaterwalk() && MoveInfo->HasMovementFlag(MOVEFLAG_WATERWALKING))
     {
-        m_Player->SetWaterWalk(false);
+        m_Actions->DisableWaterWalk();
 
-        if (m_Player->GetSession()->GetSecurity() > SEC_PLAYER)
-            m_Player->BoxChat << "WATERWALK CHEAT" << "\n";
+        if (m_Actions->ShowCheatDetails())
+            m_Actions->GetBoxChat() << "WATERWALK CHEAT" << "\n";
 
         return true;
     }
 
-    return true;
+    return false;
 }
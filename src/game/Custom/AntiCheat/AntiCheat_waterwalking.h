@@ -5,7 +5,7 @@
 class AntiCheat_waterwalking : public AntiCheat
 {
 public:
-    AntiCheat_waterwalking(CPlayer* player);
+    AntiCheat_waterwalking(AntiCheatActions* actions);
 
     bool HandleMovement(const MovementInfoPtr& MoveInfo, Opcodes opcode, AntiCheatFields& triggeredcheats) override;
 };
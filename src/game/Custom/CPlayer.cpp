@@ -21,7 +21,9 @@
 #include "AntiCheat/AntiCheat_nofall.h"
 #include "AntiCheat/AntiCheat_test.h"
 #include "AntiCheat/AntiCheat_time.h"
+#include "AntiCheat/AntiCheatRecorder.h"
 
+#include <chrono>
 #include <iomanip>
 
 CPlayer::CPlayer(WorldSession* session) : Player(session)
@@ -57,35 +59,175 @@ CPlayer::CPlayer(WorldSession* session) : Player(session)
 CPlayer::~CPlayer()
 = default;
 
-bool CPlayer::HandleAntiCheat(const MovementInfoPtr& moveInfo, Opcodes opcode)
+void CPlayer::HandleAntiCheat(const MovementInfoPtr& moveInfo, Opcodes opcode)
 {
-    if (!IsInWorld())
-        return false;
-
-    AntiCheatFields cheatFields;
-
-    for (auto& i : antiCheatStorage)
-        i->HandleMovement(moveInfo, opcode, cheatFields);
+    if (!IsInWorld() || antiCheatStorage.empty())
+        return;
 
-    return cheatFields.any();
+    AntiCheatEvent event(ANTICHEAT_EVENT_MOVEMENT);
+    event.opcode = opcode;
+    event.mapId = GetMapId();
+    event.state = GetAntiCheatState();
+    event.moveInfo = std::make_shared<MovementInfo>(*moveInfo);
+    antiCheatQueue.push_back(std::move(event));
 }
 
 void CPlayer::HandleKnockBack(float angle, float horizontalSpeed, float verticalSpeed)
 {
-    for (auto& i : antiCheatStorage)
-        i->HandleKnockBack(angle, horizontalSpeed, verticalSpeed);
+    if (antiCheatStorage.empty())
+        return;
+
+    AntiCheatEvent event(ANTICHEAT_EVENT_KNOCKBACK);
+    event.mapId = GetMapId();
+    event.state = GetAntiCheatState();
+    event.angle = angle;
+    event.horizontalSpeed = horizontalSpeed;
+    event.verticalSpeed = verticalSpeed;
+    antiCheatQueue.push_back(std::move(event));
 }
 
 void CPlayer::HandleRelocate(float x, float y, float z, float o)
 {
-    for (auto& i : antiCheatStorage)
-        i->HandleRelocate(x, y, z, o);
+    // the checks only follow relocation on taxi flights, and only the last position of a row of them
+    if (antiCheatStorage.empty() || !IsTaxiFlying())
+        return;
+
+    if (antiCheatQueue.empty() || antiCheatQueue.back().type != ANTICHEAT_EVENT_RELOCATE)
+        antiCheatQueue.emplace_back(ANTICHEAT_EVENT_RELOCATE);
+
+    AntiCheatEvent& event = antiCheatQueue.back();
+    event.mapId = GetMapId();
+    event.state = GetAntiCheatState();
+    event.x = x;
+    event.y = y;
+    event.z = z;
+    event.o = o;
 }
 
 void CPlayer::HandleTeleport(uint32 map, float x, float y, float z, float o)
 {
-    for (auto& i : antiCheatStorage)
-        i->HandleTeleport(map, x, y, z, o);
+    if (antiCheatStorage.empty())
+        return;
+
+    AntiCheatEvent event(ANTICHEAT_EVENT_TELEPORT);
+    event.mapId = map;
+    event.state = GetAntiCheatState();
+    event.x = x;
+    event.y = y;
+    event.z = z;
+    event.o = o;
+    antiCheatQueue.push_back(std::move(event));
+}
+
+AntiCheatPlayerState CPlayer::GetAntiCheatState() const
+{
+    AntiCheatPlayerState state;
+    state.mapId = GetMapId();
+    state.x = GetPositionX();
+    state.y = GetPositionY();
+    state.z = GetPositionZ();
+    state.alive = IsAlive();
+    state.inWater = IsInWater();
+    state.taxiFlying = IsTaxiFlying();
+    state.canFly = HasAuraType(SPELL_AURA_FLY) || HasAuraType(SPELL_AURA_MOD_FLIGHT_SPEED_MOUNTED) || GetGMFly();
+    state.waterWalk = HasAuraType(SPELL_AURA_WATER_WALK) || HasAuraType(SPELL_AURA_GHOST);
+    state.featherFall = HasAuraType(SPELL_AURA_FEATHER_FALL);
+    state.latency = GetSession()->GetLatency();
+    for (uint8 i = 0; i < MAX_MOVE_TYPE; ++i)
+        state.speeds[i] = GetSpeed(UnitMoveType(i));
+
+    return state;
+}
+
+bool CPlayer::ShowCheatDetails() const
+{
+    return GetSession()->GetSecurity() > SEC_PLAYER;
+}
+
+void CPlayer::TeleportBack(uint32 mapId, Position const* pos)
+{
+    TeleportToPos(mapId, pos, TELE_TO_NOT_LEAVE_COMBAT);
+}
+
+float CPlayer::GetStaticHeight(float x, float y, float z) const
+{
+    return GetTerrain()->GetHeightStatic(x, y, z, true);
+}
+
+void CPlayer::KillFallToVoid()
+{
+    EnvironmentalDamage(DAMAGE_FALL_TO_VOID, GetHealth());
+}
+
+void CPlayer::ValidateMovement()
+{
+    if (antiCheatQueue.empty())
+        return;
+
+    auto start = std::chrono::steady_clock::now();
+    bool record = sAntiCheatRecorder.IsOpen();
+    uint32 validated = 0;
+    uint32 detected = 0;
+
+    // the checks act on the player, whose hooks queue new events, those are validated at the next update
+    AntiCheatQueue queue;
+    queue.swap(antiCheatQueue);
+
+    // same as in opcode handlers, far teleports of the checks are done once all events are validated
+    SetCanDelayTeleport(true);
+
+    for (AntiCheatEvent const& event : queue)
+    {
+        AntiCheatFields cheatFields;
+        AntiCheatFields detectedFields;
+
+        for (auto& i : antiCheatStorage)
+            i->SetPlayerState(event.state);
+
+        switch (event.type)
+        {
+            case ANTICHEAT_EVENT_MOVEMENT:
+                for (auto& i : antiCheatStorage)
+                    if (i->HandleMovement(event.moveInfo, event.opcode, cheatFields))
+                        detectedFields.set(i->GetCheatType());
+
+                detectedFields |= cheatFields;
+                ++validated;
+                if (detectedFields.any())
+                    ++detected;
+                break;
+            case ANTICHEAT_EVENT_RELOCATE:
+                for (auto& i : antiCheatStorage)
+                    i->HandleRelocate(event.x, event.y, event.z, event.o);
+                break;
+            case ANTICHEAT_EVENT_TELEPORT:
+                for (auto& i : antiCheatStorage)
+                    i->HandleTeleport(event.mapId, event.x, event.y, event.z, event.o);
+                break;
+            case ANTICHEAT_EVENT_KNOCKBACK:
+                for (auto& i : antiCheatStorage)
+                    i->HandleKnockBack(event.angle, event.horizontalSpeed, event.verticalSpeed);
+                break;
+        }
+
+        if (record)
+            sAntiCheatRecorder.Record(this, event, detectedFields);
+    }
+
+    SetCanDelayTeleport(false);
+
+    // keep the allocation if nothing was queued meanwhile
+    if (antiCheatQueue.empty())
+    {
+        queue.clear();
+        antiCheatQueue.swap(queue);
+    }
+
+    sAntiCheatRecorder.AddValidation(validated, detected,
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+    if (IsHasDelayedTeleport())
+        TeleportTo(m_teleport_dest, m_teleport_options);
 }
 
 void CPlayer::SendStreamMessages(MessageType type, std::stringstream &ss)
@@ -117,6 +259,8 @@ void CPlayer::SendStreamMessages(MessageType type, std::stringstream &ss)
 
 void CPlayer::Update(uint32 update_diff)
 {
+    ValidateMovement();
+
     Player::Update(update_diff);
 
     SendStreamMessages(MessageType(CHAT_BOX), BoxChat);
@@ -127,6 +271,14 @@ void CPlayer::Update(uint32 update_diff)
         i->HandleUpdate(update_diff);
 }
 
+void CPlayer::RemoveFromWorld()
+{
+    // events of the old map must not be validated, and possibly teleported back to, on the new one
+    antiCheatQueue.clear();
+
+    Player::RemoveFromWorld();
+}
+
 bool CPlayer::AddAura(uint32 spellid)
 {
     auto const* spellInfo = sSpellTemplate.LookupEntry<SpellEntry>(spellid);
@@ -1,21 +1,22 @@
 #pragma once
 
 #include "Entities/Player.h"
+#include "Custom/AntiCheat/AntiCheat.h"
 
 #include <sstream>
 
-class AntiCheat;
 struct Position;
 enum MessageType : uint8;
 
 typedef std::map<ObjectGuid, float> DMGHEALMap;
 typedef std::vector<std::string> RewardMap;
 
-class CPlayer : public Player
+class CPlayer : public Player, public AntiCheatActions
 {
 public:
     typedef std::unique_ptr<AntiCheat> AntiCheatPtr;
     typedef std::vector<AntiCheatPtr> AntiCheatStorage;
+    typedef std::vector<AntiCheatEvent> AntiCheatQueue;
 
 public:
     explicit CPlayer(WorldSession* session);
@@ -42,15 +43,27 @@ private:
 
     // AntiCheat
 public:
-    bool HandleAntiCheat(const MovementInfoPtr& moveInfo, Opcodes opcode);
+    // queue the event for the checks, they run over all queued events once per update
+    void HandleAntiCheat(const MovementInfoPtr& moveInfo, Opcodes opcode);
     void HandleKnockBack(float angle, float horizontalSpeed, float verticalSpeed);
     void HandleRelocate(float x, float y, float z, float o);
     void HandleTeleport(uint32 map, float x, float y, float z, float o);
+    void ValidateMovement();
+    AntiCheatPlayerState GetAntiCheatState() const;
     void SetGMFly(bool value) { m_GMFly = value; }
-    bool GetGMFly() { return m_GMFly; }
+    bool GetGMFly() const { return m_GMFly; }
+
+    bool ShowCheatDetails() const override;
+    std::ostream& GetBoxChat() override { return BoxChat; }
+    void TeleportBack(uint32 mapId, Position const* pos) override;
+    void DisableFly() override { SetCanFly(false); }
+    void DisableWaterWalk() override { SetWaterWalk(false); }
+    float GetStaticHeight(float x, float y, float z) const override;
+    void KillFallToVoid() override;
 
 private:
     AntiCheatStorage antiCheatStorage;
+    AntiCheatQueue antiCheatQueue;
     bool m_GMFly;
 
     // Chat messages
@@ -64,6 +77,7 @@ public:
     // Virtualised Player functions
 public:
     void Update(uint32 update_diff) override;
+    void RemoveFromWorld() override;
 
     // Misc
 public:
@@ -8,6 +8,7 @@
 #include "SpellRegulator.hpp"
 #include "AutoBroadcast.hpp"
 #include "AutoLearnSpells.hpp"
+#include "AntiCheat/AntiCheatRecorder.h"
 
 Custom::Custom()
 {
@@ -64,4 +65,5 @@ void Custom::LoadConfig()
     sWorld.setConfig(CONFIG_UINT32_PVPREWARD_AMOUNT, "Custom.PvPReward.Amount", 0);
     m_timers[CUPDATE_AUTOBROADCAST].SetInterval(sWorld.getConfig(CONFIG_UINT32_AUTOBROADCAST_TIMER) * IN_MILLISECONDS);
     autoBroadcast->SetAutoBroadcastPrefix(sConfig.GetStringDefault("Custom.AutoBroadcastPrefix", ""));
+    sAntiCheatRecorder.Open(sConfig.GetStringDefault("Custom.AntiCheat.RecordFile", ""));
 }
@@ -0,0 +1,163 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Entities/CharacterEnumCache.h"
+#include "Policies/Singleton.h"
+#include "World/World.h"
+#include "WorldPacket.h"
+#include "Timer.h"
+#include "Metric/Metric.h"
+
+INSTANTIATE_SINGLETON_1(CharacterEnumCache);
+
+CharacterEnumCache::CharacterEnumCache() : m_hits(0), m_misses(0)
+{
+}
+
+bool CharacterEnumCache::BuildEnumPacket(uint32 accountId, WorldPacket& data, uint8& count)
+{
+    if (!sWorld.getConfig(CONFIG_UINT32_CHARACTER_ENUM_CACHE_SIZE))
+        return false;
+
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    AccountMap::iterator itr = m_accounts.find(accountId);
+    if (itr == m_accounts.end())
+    {
+        ++m_misses;
+        return false;
+    }
+
+    ++m_hits;
+    itr->second.lastUse = WorldTimer::getMSTime();
+
+    count = 0;
+    for (CachedCharacter const& character : itr->second.characters)
+    {
+        data.append(character.enumData.data(), character.enumData.size());
+        ++count;
+    }
+
+    return true;
+}
+
+void CharacterEnumCache::SetPending(uint32 accountId)
+{
+    if (!sWorld.getConfig(CONFIG_UINT32_CHARACTER_ENUM_CACHE_SIZE))
+        return;
+
+    std::lock_guard<std::mutex> guard(m_lock);
+    m_pendingAccounts.insert(accountId);
+}
+
+void CharacterEnumCache::Store(uint32 accountId, std::vector<std::pair<uint32, std::vector<uint8>>>& characters)
+{
+    uint32 maxAccounts = sWorld.getConfig(CONFIG_UINT32_CHARACTER_ENUM_CACHE_SIZE);
+    if (!maxAccounts)
+        return;
+
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    // invalidated while the query was running, result may be outdated
+    if (m_pendingAccounts.erase(accountId) == 0)
+        return;
+
+    AccountMap::iterator itr = m_accounts.find(accountId);
+    if (itr != m_accounts.end())
+        RemoveAccount(itr);
+
+    // evict least recently used account
+    if (m_accounts.size() >= maxAccounts)
+    {
+        AccountMap::iterator oldest = m_accounts.begin();
+        for (AccountMap::iterator accItr = m_accounts.begin(); accItr != m_accounts.end(); ++accItr)
+            if (WorldTimer::getMSTimeDiff(accItr->second.lastUse, WorldTimer::getMSTime()) > WorldTimer::getMSTimeDiff(oldest->second.lastUse, WorldTimer::getMSTime()))
+                oldest = accItr;
+        RemoveAccount(oldest);
+    }
+
+    CachedAccount& account = m_accounts[accountId];
+    account.lastUse = WorldTimer::getMSTime();
+    account.characters.reserve(characters.size());
+    for (auto& character : characters)
+    {
+        account.characters.push_back(CachedCharacter{ character.first, std::move(character.second) });
+        m_characterAccounts[character.first] = accountId;
+    }
+}
+
+void CharacterEnumCache::RemoveAccount(AccountMap::iterator itr)
+{
+    for (CachedCharacter const& character : itr->second.characters)
+        m_characterAccounts.erase(character.guid);
+    m_accounts.erase(itr);
+}
+
+void CharacterEnumCache::InvalidateAccount(uint32 accountId)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    m_pendingAccounts.erase(accountId);
+
+    AccountMap::iterator itr = m_accounts.find(accountId);
+    if (itr != m_accounts.end())
+        RemoveAccount(itr);
+}
+
+void CharacterEnumCache::InvalidateCharacter(uint32 guidLow)
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    CharacterAccountMap::const_iterator charItr = m_characterAccounts.find(guidLow);
+    if (charItr == m_characterAccounts.end())
+    {
+        // owner unknown, a running enum query may belong to it
+        m_pendingAccounts.clear();
+        return;
+    }
+
+    uint32 accountId = charItr->second;
+    m_pendingAccounts.erase(accountId);
+
+    AccountMap::iterator itr = m_accounts.find(accountId);
+    if (itr != m_accounts.end())
+        RemoveAccount(itr);
+}
+
+void CharacterEnumCache::InvalidateAll()
+{
+    std::lock_guard<std::mutex> guard(m_lock);
+
+    m_pendingAccounts.clear();
+    m_accounts.clear();
+    m_characterAccounts.clear();
+}
+
+void CharacterEnumCache::GenerateMetrics()
+{
+    uint32 accounts;
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        accounts = m_accounts.size();
+    }
+
+    metric::measurement meas("world.metrics.charenum");
+    meas.add_field("hits", std::to_string(m_hits.exchange(0)));
+    meas.add_field("misses", std::to_string(m_misses.exchange(0)));
+    meas.add_field("accounts", std::to_string(accounts));
+}
@@ -0,0 +1,79 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _CHARACTERENUMCACHE_H
+#define _CHARACTERENUMCACHE_H
+
+#include "Common.h"
+
+#include <atomic>
+#include <mutex>
+
+class WorldPacket;
+
+/// Keeps the SMSG_CHAR_ENUM character blocks of recently enumerated accounts, so character screen
+/// refreshes and relogs don't rerun the characters/pet/guild join. Every code path changing data
+/// shown in the enum must invalidate the account or character here.
+class CharacterEnumCache
+{
+        struct CachedCharacter
+        {
+            uint32 guid;
+            std::vector<uint8> enumData;                    // output of Player::BuildEnumData
+        };
+
+        struct CachedAccount
+        {
+            std::vector<CachedCharacter> characters;        // in enum (guid) order
+            uint32 lastUse;
+        };
+
+        typedef std::unordered_map<uint32 /*accountId*/, CachedAccount> AccountMap;
+        typedef std::unordered_map<uint32 /*guidLow*/, uint32 /*accountId*/> CharacterAccountMap;
+
+    public:
+        CharacterEnumCache();
+
+        // fill packet (without character count) and return count, false on miss
+        bool BuildEnumPacket(uint32 accountId, WorldPacket& data, uint8& count);
+
+        // enum query for account is sent, its result may only be stored if nothing was invalidated meanwhile
+        void SetPending(uint32 accountId);
+        void Store(uint32 accountId, std::vector<std::pair<uint32, std::vector<uint8>>>& characters);
+
+        void InvalidateAccount(uint32 accountId);
+        void InvalidateCharacter(uint32 guidLow);
+        void InvalidateAll();
+
+        void GenerateMetrics();
+
+    private:
+        void RemoveAccount(AccountMap::iterator itr);
+
+        std::mutex m_lock;
+        AccountMap m_accounts;
+        CharacterAccountMap m_characterAccounts;
+        std::set<uint32> m_pendingAccounts;
+
+        std::atomic<uint32> m_hits;
+        std::atomic<uint32> m_misses;
+};
+
+#define sCharacterEnumCache MaNGOS::Singleton<CharacterEnumCache>::Instance()
+
+#endif // _CHARACTERENUMCACHE_H
@@ -41,6 +41,9 @@
 #include "AI/ScriptDevAI/ScriptDevAIMgr.h"
 #include "Spells/SpellMgr.h"
 #include "Custom/CPlayer.h"
+#include "Entities/CharacterEnumCache.h"
+#include "Mails/MailExpiryMgr.h"
+#include "Metric/Metric.h"
 
 #ifdef BUILD_PLAYERBOT
 #include "PlayerBot/Base/PlayerbotMgr.h"
@@ -125,6 +128,10 @@ class CharacterHandler
         {
             if (!holder) return;
 
+            metric::measurement meas("player.login.holder");
+            meas.add_field("queue_ms", std::to_string(holder->GetQueueDelay()));
+            meas.add_field("execute_ms", std::to_string(holder->GetExecutionTime()));
+
             if (WorldSession* session = sWorld.FindSession(((LoginQueryHolder*)holder)->GetAccountId()))
                 session->HandlePlayerLogin((LoginQueryHolder*)holder);
         }
@@ -164,20 +171,28 @@ void WorldSession::HandleCharEnum(QueryResult* result)
 
     data << num;
 
+    std::vector<std::pair<uint32, std::vector<uint8>>> enumCache;
+
     if (result)
     {
         do
         {
             uint32 guidlow = (*result)[0].GetUInt32();
             DETAIL_LOG("Build enum data for char guid %u from account %u.", guidlow, GetAccountId());
+            size_t startPos = data.wpos();
             if (Player::BuildEnumData(result, data))
+            {
                 ++num;
+                enumCache.push_back({ guidlow, std::vector<uint8>(data.contents() + startPos, data.contents() + data.wpos()) });
+            }
         }
         while (result->NextRow());
 
         delete result;
     }
 
+    sCharacterEnumCache.Store(GetAccountId(), enumCache);
+
     data.put<uint8>(0, num);
 
     SendPacket(data, true);
@@ -185,6 +200,20 @@ void WorldSession::HandleCharEnum(QueryResult* result)
 
 void WorldSession::HandleCharEnumOpcode(WorldPacket& /*recv_data*/)
 {
+    {
+        WorldPacket data(SMSG_CHAR_ENUM, 100);
+        uint8 num = 0;
+        data << num;
+        if (sCharacterEnumCache.BuildEnumPacket(GetAccountId(), data, num))
+        {
+            data.put<uint8>(0, num);
+            SendPacket(data, true);
+            return;
+        }
+    }
+
+    sCharacterEnumCache.SetPending(GetAccountId());
+
     /// get all the data necessary for loading all characters (along with their pets) on the account
     CharacterDatabase.AsyncPQuery(&chrHandler, &CharacterHandler::HandleCharEnumCallback, GetAccountId(),
                                   !sWorld.getConfig(CONFIG_BOOL_DECLINED_NAMES_USED) ?
@@ -593,6 +622,8 @@ void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder)
 
     m_currentPlayerLevel = pCurrChar->getLevel();
 
+    sMailExpiryMgr.OnPlayerLogin(playerGuid);
+
     pCurrChar->GetMotionMaster()->Initialize();
 
     Group* group = pCurrChar->GetGroup();
@@ -1115,6 +1146,8 @@ void WorldSession::HandleChangePlayerNameOpcodeCallBack(QueryResult* result, uin
     CharacterDatabase.PExecute("DELETE FROM character_declinedname WHERE guid ='%u'", guidLow);
     CharacterDatabase.CommitTransaction();
 
+    sCharacterEnumCache.InvalidateAccount(session->GetAccountId());
+
     sLog.outChar("Account: %d (IP: %s) Character:[%s] (guid:%u) Changed name to: %s", session->GetAccountId(), session->GetRemoteAddress().c_str(), oldname.c_str(), guidLow, newname.c_str());
 
     WorldPacket data(SMSG_CHAR_RENAME, 1 + 8 + (newname.size() + 1));
@@ -1207,6 +1240,8 @@ void WorldSession::HandleSetPlayerDeclinedNamesOpcode(WorldPacket& recv_data)
                                guid.GetCounter(), declinedname.name[0].c_str(), declinedname.name[1].c_str(), declinedname.name[2].c_str(), declinedname.name[3].c_str(), declinedname.name[4].c_str());
     CharacterDatabase.CommitTransaction();
 
+    sCharacterEnumCache.InvalidateAccount(GetAccountId());
+
     WorldPacket data(SMSG_SET_PLAYER_DECLINED_NAMES_RESULT, 4 + 8);
     data << uint32(0);                                      // OK
     data << ObjectGuid(guid);
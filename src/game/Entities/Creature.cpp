@@ -45,6 +45,7 @@
 #include "Grids/GridNotifiersImpl.h"
 #include "Grids/CellImpl.h"
 #include "Movement/MoveSplineInit.h"
+#include "Movement/MoveSpline.h"
 #include "Entities/CreatureLinkingMgr.h"
 
 // apply implementation of the singletons
@@ -136,7 +137,7 @@ Creature::Creature(CreatureSubtype subtype) : Unit(),
     m_respawnTime(0), m_respawnDelay(25), m_respawnOverriden(false), m_respawnOverrideOnce(false), m_corpseDelay(60), m_canAggro(false),
     m_respawnradius(5.0f), m_subtype(subtype), m_defaultMovementType(IDLE_MOTION_TYPE),
     m_equipmentId(0), m_AlreadyCallAssistance(false),
-    m_isDeadByDefault(false),
+    m_isDeadByDefault(false), m_dormantTime(0), m_dormantCheckTimer(0),
     m_temporaryFactionFlags(TEMPFACTION_NONE),
     m_originalEntry(0), m_gameEventVendorId(0), m_ai(nullptr),
     m_isInvisible(false), m_ignoreMMAP(false), m_forceAttackingCapability(false),
@@ -615,8 +616,60 @@ uint32 Creature::ChooseDisplayId(const CreatureInfo* cinfo, const CreatureData*
     return display_id;
 }
 
-void Creature::Update(const uint32 diff)
+bool Creature::CanBecomeDormant()
 {
+    if (m_deathState != ALIVE || m_isDeadByDefault || !IsInWorld())
+        return false;
+
+    if (GetObjectGuid().GetHigh() != HIGHGUID_UNIT || IsTemporarySummon() || GetMasterGuid())
+        return false;
+
+    if (!AI() || !AI()->CanSleepOutOfCombat())
+        return false;
+
+    if (IsInCombat() || GetVictim() || !m_events.Empty() || IsNonMeleeSpellCasted(true))
+        return false;
+
+    if (!movespline->Finalized() || i_motionMaster.GetCurrentMovementGeneratorType() != IDLE_MOTION_TYPE)
+        return false;
+
+    if (GetHealth() < GetMaxHealth() || GetPower(GetPowerType()) < GetMaxPower(GetPowerType()))
+        return false;
+
+    // timed and periodic auras need their ticks
+    for (const auto& holderPair : m_spellAuraHolders)
+    {
+        SpellAuraHolder const* holder = holderPair.second;
+        if (!holder->IsPermanent())
+            return false;
+
+        for (uint32 i = 0; i < MAX_EFFECT_INDEX; ++i)
+            if (Aura const* aura = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
+                if (aura->IsPeriodic())
+                    return false;
+    }
+
+    return true;
+}
+
+void Creature::Update(const uint32 tickDiff)
+{
+    // Dormant creatures skip ticks until the configured interval passed and then catch up with the skipped time.
+    // A creature woken by a state change (new aura, spell, combat, movement) is updated at once, but only with
+    // the last tick, because the state change happened within that tick.
+    uint32 diff = tickDiff;
+    uint32 dormantInterval = sWorld.getConfig(CONFIG_UINT32_CREATURE_DORMANT_UPDATE_INTERVAL);
+    if (m_dormant)
+    {
+        m_dormantTime += tickDiff;
+        if (dormantInterval && m_dormantTime < dormantInterval)
+            return;
+
+        diff = m_dormantTime;
+        m_dormant = false;
+        m_dormantCheckTimer = 0;                            // check again right after the catch up update
+    }
+
     switch (m_deathState)
     {
         case JUST_ALIVED:
@@ -705,6 +758,19 @@ void Creature::Update(const uint32 diff)
             if (IsAlive())
                 RegenerateAll(diff);
 
+            // checked once per interval only, until then the creature is just updated
+            if (dormantInterval)
+            {
+                if (m_dormantCheckTimer <= diff)
+                {
+                    m_dormantCheckTimer = dormantInterval;
+                    m_dormant = CanBecomeDormant();
+                    m_dormantTime = 0;
+                }
+                else
+                    m_dormantCheckTimer -= diff;
+            }
+
             break;
         }
         default:
@@ -813,6 +879,7 @@ void Creature::RegenerateHealth()
 
 bool Creature::AIM_Initialize()
 {
+    WakeUp();
     i_motionMaster.Initialize();
     m_ai.reset(FactorySelector::selectAI(this));
 
@@ -1686,6 +1753,8 @@ void Creature::DeleteFromDB(uint32 lowguid, CreatureData const* data)
 
 void Creature::SetDeathState(DeathState s)
 {
+    WakeUp();
+
     if ((s == JUST_DIED && !m_isDeadByDefault) || (s == JUST_ALIVED && m_isDeadByDefault))
     {
         if (!m_respawnOverriden)
@@ -1769,6 +1838,7 @@ void Creature::ForcedDespawn(uint32 timeMSToDespawn, bool onlyAlive)
         ForcedDespawnDelayEvent* pEvent = new ForcedDespawnDelayEvent(*this, onlyAlive);
 
         m_events.AddEvent(pEvent, m_events.CalculateTime(timeMSToDespawn));
+        WakeUp();
         return;
     }
 
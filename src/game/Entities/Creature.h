@@ -596,6 +596,7 @@ class Creature : public Unit
         char const* GetSubName() const { return GetCreatureInfo()->SubName; }
 
         void Update(const uint32 diff) override;  // overwrite Unit::Update
+        bool CanBecomeDormant();                            // idle creature that can skip updates, see CONFIG_UINT32_CREATURE_DORMANT_UPDATE_INTERVAL
 
         virtual void RegenerateAll(uint32 update_diff);
         uint32 GetEquipmentId() const { return m_equipmentId; }
@@ -918,6 +919,8 @@ class Creature : public Unit
         // below fields has potential for optimization
         bool m_AlreadyCallAssistance;
         bool m_isDeadByDefault;
+        uint32 m_dormantTime;                               // (msecs) update time skipped while dormant
+        uint32 m_dormantCheckTimer;                         // (msecs) time left until CanBecomeDormant() is checked again
         uint32 m_temporaryFactionFlags;                     // used for real faction changes (not auras etc)
 
         uint32 m_originalEntry;
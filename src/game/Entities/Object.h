@@ -32,6 +32,7 @@
 #include "PlayerDefines.h"
 #include "Entities/ObjectVisibility.h"
 
+#include <memory_resource>
 #include <set>
 
 enum TempSpawnType
@@ -110,7 +111,7 @@ class ChatHandler;
 struct SpellEntry;
 class Spell;
 
-typedef std::unordered_map<Player*, UpdateData> UpdateDataMapType;
+typedef std::pmr::unordered_map<Player*, UpdateData> UpdateDataMapType;
 
 class CooldownData
 {
@@ -635,7 +636,17 @@ class Object
             float*  m_floatValues;
         };
 
-        std::vector<bool> m_changedValues;
+        // changed fields since the last ClearUpdateMask, one bit per field, and the words of it that have any bit set
+        std::vector<uint64> m_changedValues;
+        std::vector<uint16> m_changedWords;
+
+        void MarkFieldChanged(uint16 index)
+        {
+            uint64& word = m_changedValues[index >> 6];
+            if (!word)
+                m_changedWords.push_back(index >> 6);
+            word |= uint64(1) << (index & 63);
+        }
 
         uint16 m_valuesCount;
 
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Entities/OldCharacterDeletion.h"
+#include "Policies/Singleton.h"
+#include "Database/DatabaseEnv.h"
+#include "Database/DatabaseImpl.h"
+#include "World/World.h"
+
+INSTANTIATE_SINGLETON_1(OldCharacterDeletion);
+
+OldCharacterDeletion::OldCharacterDeletion() : m_state(OLD_CHARACTERS_IDLE)
+{
+}
+
+void OldCharacterDeletion::HandleCharactersCallback(QueryResult* result, uint64 /*deleteBefore*/)
+{
+    // job was stopped meanwhile
+    if (m_state != OLD_CHARACTERS_WAITING)
+    {
+        delete result;
+        return;
+    }
+
+    m_state = OLD_CHARACTERS_PROCESS;
+    Player::ReadOldCharacters(result, m_characters);
+}
+
+bool OldCharacterDeletion::Update(TimeBudget const& budget)
+{
+    uint32 keepDays = sWorld.getConfig(CONFIG_UINT32_CHARDELETE_KEEP_DAYS);
+    if (!keepDays)
+    {
+        // a pending query result is dropped by its callback state check
+        m_characters.clear();
+        m_state = OLD_CHARACTERS_IDLE;
+        return true;
+    }
+
+    switch (m_state)
+    {
+        case OLD_CHARACTERS_IDLE:
+        {
+            uint64 deleteBefore = uint64(time(nullptr) - time_t(keepDays * DAY));
+            m_state = OLD_CHARACTERS_WAITING;
+            CharacterDatabase.AsyncPQuery(this, &OldCharacterDeletion::HandleCharactersCallback, deleteBefore,
+                                          "SELECT guid, deleteInfos_Account FROM characters WHERE deleteDate IS NOT NULL AND deleteDate < '" UI64FMTD "'", deleteBefore);
+            return false;
+        }
+        case OLD_CHARACTERS_WAITING:
+            return false;
+        case OLD_CHARACTERS_PROCESS:
+            break;
+    }
+
+    while (!m_characters.empty())
+    {
+        Player::DeleteFromDB(ObjectGuid(HIGHGUID_PLAYER, m_characters.front().first), m_characters.front().second, true, true);
+        m_characters.pop_front();
+
+        if (budget.Exceeded())
+            return false;
+    }
+
+    m_state = OLD_CHARACTERS_IDLE;
+    return true;
+}
@@ -0,0 +1,55 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _OLDCHARACTERDELETION_H
+#define _OLDCHARACTERDELETION_H
+
+#include "Common.h"
+#include "Entities/Player.h"
+#include "Timer.h"
+
+class QueryResult;
+
+/// Housekeeping job completely deleting the characters deleted CharDelete.KeepDays before, see HOUSEKEEPING_OLD_CHARACTERS.
+/// The characters are found by one async query, then deleted over several world ticks within the housekeeping budget.
+class OldCharacterDeletion
+{
+    public:
+        OldCharacterDeletion();
+
+        // called from world thread, returns true when all found characters are deleted
+        bool Update(TimeBudget const& budget);
+
+        // async query callback, executed in world thread
+        void HandleCharactersCallback(QueryResult* result, uint64 deleteBefore);
+
+    private:
+        enum State
+        {
+            OLD_CHARACTERS_IDLE,                            // characters must be queried
+            OLD_CHARACTERS_WAITING,                         // waiting for query result
+            OLD_CHARACTERS_PROCESS,                         // found characters are deleted
+        };
+
+        State m_state;
+        Player::OldCharacterQueue m_characters;
+};
+
+#define sOldCharacterDeletion MaNGOS::Singleton<OldCharacterDeletion>::Instance()
+
+#endif // _OLDCHARACTERDELETION_H
@@ -63,6 +63,8 @@
 #include "Loot/LootMgr.h"
 #include "World/WorldStateDefines.h"
 #include "World/WorldState.h"
+#include "Entities/CharacterEnumCache.h"
+#include "Metric/Metric.h"
 
 #include "Custom/CPlayer.h"
 
@@ -560,6 +562,9 @@ Player::Player(WorldSession* session): Unit(), m_taxiTracker(*this), m_mover(thi
     m_WeeklyQuestChanged = false;
     m_MonthlyQuestChanged = false;
 
+    m_savedRowsSynced = false;
+    m_saveRowCount = 0;
+
     m_lastLiquid = nullptr;
 
     m_drunkTimer = 0;
@@ -1510,13 +1515,26 @@ void Player::Update(const uint32 diff)
     {
         if (diff >= m_nextSave)
         {
-            // m_nextSave reseted in SaveToDB call
-            SaveToDB();
-            DETAIL_LOG("Player '%s' (GUID: %u) saved", GetName(), GetGUIDLow());
+            // save slot is given out by PlayerSaveScheduler from world thread
+            if (sWorld.getConfig(CONFIG_BOOL_PLAYER_SAVE_SCHEDULER))
+                m_nextSave = 0;
+            else
+            {
+                // m_nextSave reseted in SaveToDB call
+                SaveToDB();
+                DETAIL_LOG("Player '%s' (GUID: %u) saved", GetName(), GetGUIDLow());
+            }
         }
         else
             m_nextSave -= diff;
     }
+    else if (uint32 interval = sWorld.getConfig(CONFIG_UINT32_INTERVAL_SAVE))
+    {
+        // timer stopped by disabled saving or by the scheduler that got disabled at config reload,
+        // restart it randomized like at login so not all players save in the same tick
+        if (!sWorld.getConfig(CONFIG_BOOL_PLAYER_SAVE_SCHEDULER))
+            m_nextSave = urand(1, interval);
+    }
 
     // Handle detect stealth players
     if (m_DetectInvTimer > 0)
@@ -3411,7 +3429,7 @@ bool Player::addSpell(uint32 spell_id, bool active, bool learning, bool dependen
     // learn dependent spells
     SpellLearnSpellMapBounds spell_bounds = sSpellMgr.GetSpellLearnSpellMapBounds(spell_id);
 
-    for (SpellLearnSpellMap::const_iterator itr2 = spell_bounds.first; itr2 != spell_bounds.second; ++itr2)
+    for (auto itr2 = spell_bounds.first; itr2 != spell_bounds.second; ++itr2)
     {
         SpellLearnSpellNode const& spellLearn = itr2->second;
         if (!spellLearn.autoLearned)
@@ -3483,7 +3501,7 @@ void Player::removeSpell(uint32 spell_id, bool disabled, bool learn_low_rank, bo
 
     // Always try to remove all dependent spells if present (needed to reset some talents properly)
     SpellLearnSpellMapBounds spell_bounds = sSpellMgr.GetSpellLearnSpellMapBounds(spell_id);
-    for (SpellLearnSpellMap::const_iterator child_itr = spell_bounds.first; child_itr != spell_bounds.second; ++child_itr)
+    for (auto child_itr = spell_bounds.first; child_itr != spell_bounds.second; ++child_itr)
         removeSpell(child_itr->second.spell, !IsPassiveSpell(child_itr->second.spell), !IsPassiveSpell(child_itr->second.spell));
 
     // search again just in case
@@ -3701,13 +3719,7 @@ void Player::_LoadSpellCooldowns(QueryResult* result)
 
 void Player::_SaveSpellCooldowns()
 {
-    static SqlStatementID deleteSpellCooldown;
-
-    // delete all old cooldown
-    SqlStatement stmt = CharacterDatabase.CreateStatement(deleteSpellCooldown, "DELETE FROM character_spell_cooldown WHERE guid = ?");
-    stmt.PExecute(GetGUIDLow());
-
-    static SqlStatementID insertSpellCooldown;
+    SavedCooldownMap currentCooldowns;
 
     for (auto& cdItr : m_cooldownMap)
     {
@@ -3721,16 +3733,57 @@ void Player::_SaveSpellCooldowns()
             uint64 spellExpireTime = uint64(Clock::to_time_t(sTime));
             uint64 catExpireTime = uint64(Clock::to_time_t(cTime));
 
-            stmt = CharacterDatabase.CreateStatement(insertSpellCooldown, "INSERT INTO character_spell_cooldown (guid, SpellId, SpellExpireTime, Category, CategoryExpireTime, ItemId) VALUES( ?, ?, ?, ?, ?, ?)");
-            stmt.addUInt32(GetGUIDLow());
-            stmt.addUInt32(cdData->GetSpellId());
-            stmt.addUInt64(spellExpireTime);
-            stmt.addUInt32(cdData->GetCategory());
-            stmt.addUInt64(catExpireTime);
-            stmt.addUInt32(cdData->GetItemId());
-            stmt.Execute();
+            currentCooldowns.emplace(cdData->GetSpellId(), SavedCooldownRow{ spellExpireTime, cdData->GetCategory(), catExpireTime, cdData->GetItemId() });
+        }
+    }
+
+    std::ostringstream delSql;
+    std::ostringstream insSql;
+    uint32 delCount = 0;
+    uint32 insCount = 0;
+
+    if (!m_savedRowsSynced)
+    {
+        // delete all old cooldown
+        static SqlStatementID deleteSpellCooldown;
+        SqlStatement stmt = CharacterDatabase.CreateStatement(deleteSpellCooldown, "DELETE FROM character_spell_cooldown WHERE guid = ?");
+        stmt.PExecute(GetGUIDLow());
+        ++m_saveRowCount;
+    }
+    else
+    {
+        for (auto const& savedCooldown : m_savedCooldowns)
+        {
+            auto itr = currentCooldowns.find(savedCooldown.first);
+            if (itr != currentCooldowns.end() && itr->second == savedCooldown.second)
+                continue;
+
+            delSql << (delCount++ ? "," : "") << "'" << savedCooldown.first << "'";
         }
     }
+
+    for (auto const& currentCooldown : currentCooldowns)
+    {
+        if (m_savedRowsSynced)
+        {
+            auto itr = m_savedCooldowns.find(currentCooldown.first);
+            if (itr != m_savedCooldowns.end() && itr->second == currentCooldown.second)
+                continue;
+        }
+
+        SavedCooldownRow const& row = currentCooldown.second;
+        insSql << (insCount++ ? "," : "") << "('" << GetGUIDLow() << "','" << currentCooldown.first << "','" << row[0] << "','" << row[1]
+               << "','" << row[2] << "','" << row[3] << "')";
+    }
+
+    if (delCount)
+        CharacterDatabase.Execute(("DELETE FROM character_spell_cooldown WHERE guid = '" + std::to_string(GetGUIDLow()) + "' AND SpellId IN (" + delSql.str() + ")").c_str());
+
+    if (insCount)
+        CharacterDatabase.Execute(("INSERT INTO character_spell_cooldown (guid, SpellId, SpellExpireTime, Category, CategoryExpireTime, ItemId) VALUES " + insSql.str()).c_str());
+
+    m_saveRowCount += delCount + insCount;
+    m_savedCooldowns = std::move(currentCooldowns);
 }
 
 
@@ -4154,6 +4207,9 @@ TrainerSpellState Player::GetTrainerSpellState(TrainerSpell const* trainer_spell
  */
 void Player::DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRealmChars, bool deleteFinally)
 {
+    sCharacterEnumCache.InvalidateCharacter(playerguid.GetCounter());
+    sCharacterEnumCache.InvalidateAccount(accountId);
+
     // for nonexistent account avoid update realm
     if (accountId == 0)
         updateRealmChars = false;
@@ -4393,20 +4449,44 @@ void Player::DeleteOldCharacters(uint32 keepDays)
 {
     sLog.outString("Player::DeleteOldChars: Deleting all characters which have been deleted %u days before...", keepDays);
 
-    QueryResult* resultChars = CharacterDatabase.PQuery("SELECT guid, deleteInfos_Account FROM characters WHERE deleteDate IS NOT NULL AND deleteDate < '" UI64FMTD "'", uint64(time(nullptr) - time_t(keepDays * DAY)));
-    if (resultChars)
+    OldCharacterQueue characters;
+    SelectOldCharacters(keepDays, characters);
+
+    for (auto const& character : characters)
+        Player::DeleteFromDB(ObjectGuid(HIGHGUID_PLAYER, character.first), character.second, true, true);
+
+    sLog.outString();
+}
+
+/**
+ * Appends the characters which are due to be completely deleted.
+ *
+ * @param keepDays amount of days deleted characters are kept back in the database
+ * @param characters queue receiving guid and account of the found characters
+ */
+void Player::SelectOldCharacters(uint32 keepDays, OldCharacterQueue& characters)
+{
+    ReadOldCharacters(CharacterDatabase.PQuery("SELECT guid, deleteInfos_Account FROM characters WHERE deleteDate IS NOT NULL AND deleteDate < '" UI64FMTD "'", uint64(time(nullptr) - time_t(keepDays * DAY))), characters);
+}
+
+/**
+ * Appends the characters of a guid, deleteInfos_Account query result and deletes the result.
+ *
+ * @see OldCharacterDeletion
+ */
+void Player::ReadOldCharacters(QueryResult* result, OldCharacterQueue& characters)
+{
+    if (!result)
+        return;
+
+    sLog.outString("Player::DeleteOldChars: Found %u character(s) to delete", uint32(result->GetRowCount()));
+    do
     {
-        sLog.outString("Player::DeleteOldChars: Found %u character(s) to delete", uint32(resultChars->GetRowCount()));
-        do
-        {
-            Field* charFields = resultChars->Fetch();
-            ObjectGuid guid = ObjectGuid(HIGHGUID_PLAYER, charFields[0].GetUInt32());
-            Player::DeleteFromDB(guid, charFields[1].GetUInt32(), true, true);
-        }
-        while (resultChars->NextRow());
-        delete resultChars;
+        Field* charFields = result->Fetch();
+        characters.emplace_back(charFields[0].GetUInt32(), charFields[1].GetUInt32());
     }
-    sLog.outString();
+    while (result->NextRow());
+    delete result;
 }
 
 void Player::SetWaterWalk(bool enable)
@@ -6913,7 +6993,10 @@ uint32 Player::GetZoneIdFromDB(ObjectGuid guid)
         zone = sTerrainMgr.GetZoneId(map, posx, posy, posz);
 
         if (zone > 0)
+        {
             CharacterDatabase.PExecute("UPDATE characters SET zone='%u' WHERE guid='%u'", zone, lowguid);
+            sCharacterEnumCache.InvalidateCharacter(lowguid);
+        }
     }
 
     return zone;
@@ -14883,6 +14966,7 @@ bool Player::LoadFromDB(ObjectGuid guid, SqlQueryHolder* holder)
         delete result;
         CharacterDatabase.PExecute("UPDATE characters SET at_login = at_login | '%u' WHERE guid ='%u'",
                                    uint32(AT_LOGIN_RENAME), guid.GetCounter());
+        sCharacterEnumCache.InvalidateAccount(GetSession()->GetAccountId());
         return false;
     }
 
@@ -16519,6 +16603,13 @@ void Player::SaveToDB()
     DEBUG_FILTER_LOG(LOG_FILTER_PLAYER_STATS, "The value of player %s at save: ", m_name.c_str());
     outDebugStatsValues();
 
+    sCharacterEnumCache.InvalidateAccount(GetSession()->GetAccountId());
+
+    // logout save rewrites all aura and cooldown rows, so db can't stay out of sync after a failed autosave
+    if (m_session->isLogingOut())
+        m_savedRowsSynced = false;
+    m_saveRowCount = 1;                                     // characters row
+
     CharacterDatabase.BeginTransaction();
 
     static SqlStatementID delChar ;
@@ -16699,6 +16790,11 @@ void Player::SaveToDB()
 
     CharacterDatabase.CommitTransaction();
 
+    m_savedRowsSynced = true;
+
+    metric::measurement meas("player.save");
+    meas.add_field("rows", std::to_string(m_saveRowCount));
+
     // check if stats should only be saved on logout
     // save stats can be out of transaction
     if (m_session->isLogingOut() || !sWorld.getConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT))
@@ -16742,6 +16838,7 @@ void Player::_SaveActions()
                 stmt.addUInt32(itr->second.GetAction());
                 stmt.addUInt32(uint32(itr->second.GetType()));
                 stmt.Execute();
+                ++m_saveRowCount;
                 itr->second.uState = ACTIONBUTTON_UNCHANGED;
                 ++itr;
             }
@@ -16754,6 +16851,7 @@ void Player::_SaveActions()
                 stmt.addUInt32(GetGUIDLow());
                 stmt.addUInt32(uint32(itr->first));
                 stmt.Execute();
+                ++m_saveRowCount;
                 itr->second.uState = ACTIONBUTTON_UNCHANGED;
                 ++itr;
             }
@@ -16764,6 +16862,7 @@ void Player::_SaveActions()
                 stmt.addUInt32(GetGUIDLow());
                 stmt.addUInt32(uint32(itr->first));
                 stmt.Execute();
+                ++m_saveRowCount;
                 m_actionButtons.erase(itr++);
             }
             break;
@@ -16776,71 +16875,99 @@ void Player::_SaveActions()
 
 void Player::_SaveAuras()
 {
-    static SqlStatementID deleteAuras ;
-    static SqlStatementID insertAuras ;
-
-    SqlStatement stmt = CharacterDatabase.CreateStatement(deleteAuras, "DELETE FROM character_aura WHERE guid = ?");
-    stmt.PExecute(GetGUIDLow());
-
-    SpellAuraHolderMap const& auraHolders = GetSpellAuraHolderMap();
-
-    if (auraHolders.empty())
-        return;
+    SavedAuraMap currentAuras;
 
-    stmt = CharacterDatabase.CreateStatement(insertAuras, "INSERT INTO character_aura (guid, caster_guid, item_guid, spell, stackcount, remaincharges, "
-            "basepoints0, basepoints1, basepoints2, periodictime0, periodictime1, periodictime2, maxduration, remaintime, effIndexMask) "
-            "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
-
-    for (const auto& auraHolder : auraHolders)
+    for (const auto& auraHolder : GetSpellAuraHolderMap())
     {
         SpellAuraHolder* holder = auraHolder.second;
         // skip all holders from spells that are passive or channeled
         // save singleTarget auras if self cast.
-        if (holder->IsSaveToDbHolder())
-        {
-            int32  damage[MAX_EFFECT_INDEX];
-            uint32 periodicTime[MAX_EFFECT_INDEX];
-            uint32 effIndexMask = 0;
+        if (!holder->IsSaveToDbHolder())
+            continue;
 
-            for (uint32 i = 0; i < MAX_EFFECT_INDEX; ++i)
-            {
-                damage[i] = 0;
-                periodicTime[i] = 0;
+        SavedAuraRow row = {};
+        uint32 effIndexMask = 0;
 
-                if (Aura* aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
-                {
-                    // don't save not own area auras
-                    if (!aur->IsSaveToDbAura())
-                        continue;
+        for (uint32 i = 0; i < MAX_EFFECT_INDEX; ++i)
+        {
+            if (Aura* aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
+            {
+                // don't save not own area auras
+                if (!aur->IsSaveToDbAura())
+                    continue;
 
-                    damage[i] = aur->GetModifier()->m_amount;
-                    periodicTime[i] = aur->GetModifier()->periodictime;
-                    effIndexMask |= (1 << i);
-                }
+                row[2 + i] = aur->GetModifier()->m_amount;
+                row[5 + i] = aur->GetModifier()->periodictime;
+                effIndexMask |= (1 << i);
             }
+        }
 
-            if (!effIndexMask)
-                continue;
+        if (!effIndexMask)
+            continue;
 
-            stmt.addUInt32(GetGUIDLow());
-            stmt.addUInt64(holder->GetCasterGuid().GetRawValue());
-            stmt.addUInt32(holder->GetCastItemGuid().GetCounter());
-            stmt.addUInt32(holder->GetId());
-            stmt.addUInt32(holder->GetStackAmount());
-            stmt.addUInt8(holder->GetAuraCharges());
+        row[0] = holder->GetStackAmount();
+        row[1] = uint8(holder->GetAuraCharges());
+        row[8] = holder->GetAuraMaxDuration();
+        row[9] = holder->GetAuraDuration();
+        row[10] = effIndexMask;
 
-            for (int i : damage)
-                stmt.addInt32(i);
+        currentAuras.emplace(SavedAuraKey(holder->GetCasterGuid().GetRawValue(), holder->GetCastItemGuid().GetCounter(), holder->GetId()), row);
+    }
 
-            for (unsigned int i : periodicTime)
-                stmt.addUInt32(i);
+    std::ostringstream delSql;
+    std::ostringstream insSql;
+    uint32 delCount = 0;
+    uint32 insCount = 0;
 
-            stmt.addInt32(holder->GetAuraMaxDuration());
-            stmt.addInt32(holder->GetAuraDuration());
-            stmt.addUInt32(effIndexMask);
-            stmt.Execute();
+    if (!m_savedRowsSynced)
+    {
+        delSql << "DELETE FROM character_aura WHERE guid = '" << GetGUIDLow() << "'";
+        CharacterDatabase.Execute(delSql.str().c_str());
+        ++m_saveRowCount;
+        delSql.str("");
+    }
+    else
+    {
+        // removed or changed rows
+        for (auto const& savedAura : m_savedAuras)
+        {
+            auto itr = currentAuras.find(savedAura.first);
+            if (itr != currentAuras.end() && itr->second == savedAura.second)
+                continue;
+
+            delSql << (delCount++ ? " OR " : "") << "(caster_guid = '" << std::get<0>(savedAura.first) << "' AND item_guid = '" << std::get<1>(savedAura.first)
+                   << "' AND spell = '" << std::get<2>(savedAura.first) << "')";
         }
     }
+
+    for (auto const& currentAura : currentAuras)
+    {
+        if (m_savedRowsSynced)
+        {
+            auto itr = m_savedAuras.find(currentAura.first);
+            if (itr != m_savedAuras.end() && itr->second == currentAura.second)
+                continue;
+        }
+
+        SavedAuraRow const& row = currentAura.second;
+        insSql << (insCount++ ? "," : "") << "('" << GetGUIDLow() << "','" << std::get<0>(currentAura.first) << "','" << std::get<1>(currentAura.first)
+               << "','" << std::get<2>(currentAura.first) << "'";
+        for (int64 value : row)
+            insSql << ",'" << value << "'";
+        insSql << ")";
+    }
+
+    // built as plain strings, row lists can exceed the PExecute format buffer
+    if (delCount)
+        CharacterDatabase.Execute(("DELETE FROM character_aura WHERE guid = '" + std::to_string(GetGUIDLow()) + "' AND (" + delSql.str() + ")").c_str());
+
+    if (insCount)
+        CharacterDatabase.Execute(("INSERT INTO character_aura (guid, caster_guid, item_guid, spell, stackcount, remaincharges, "
+                                   "basepoints0, basepoints1, basepoints2, periodictime0, periodictime1, periodictime2, maxduration, remaintime, effIndexMask) "
+                                   "VALUES " + insSql.str()).c_str());
+
+    m_saveRowCount += delCount + insCount;
+    m_savedAuras = std::move(currentAuras);
 }
 
 void Player::_SaveInventory()
@@ -16904,6 +17031,7 @@ void Player::_SaveInventory()
         if (!item) continue;
 
         SaveItemToInventory(item);
+        ++m_saveRowCount;
     }
     m_itemUpdateQueue.clear();
 }
@@ -17013,6 +17141,7 @@ void Player::_SaveQuestStatus()
                 for (unsigned int k : questStatus.m_itemcount)
                     stmt.addUInt32(k);
                 stmt.Execute();
+                ++m_saveRowCount;
             }
             break;
             case QUEST_CHANGED :
@@ -17031,6 +17160,7 @@ void Player::_SaveQuestStatus()
                 stmt.addUInt32(GetGUIDLow());
                 stmt.addUInt32(mQuestStatu.first);
                 stmt.Execute();
+                ++m_saveRowCount;
             }
             break;
             case QUEST_UNCHANGED:
@@ -17122,6 +17252,7 @@ void Player::_SaveSkills()
         {
             SqlStatement stmt = CharacterDatabase.CreateStatement(delSkills, "DELETE FROM character_skills WHERE guid = ? AND skill = ?");
             stmt.PExecute(GetGUIDLow(), itr->first);
+            ++m_saveRowCount;
             mSkillStatus.erase(itr++);
             continue;
         }
@@ -17150,6 +17281,7 @@ void Player::_SaveSkills()
                 break;
         }
         itr->second.uState = SKILL_UNCHANGED;
+        ++m_saveRowCount;
 
         ++itr;
     }
@@ -17168,11 +17300,17 @@ void Player::_SaveSpells()
         PlayerSpell& playerSpell = itr->second;
 
         if (playerSpell.state == PLAYERSPELL_REMOVED || playerSpell.state == PLAYERSPELL_CHANGED)
+        {
             stmtDel.PExecute(GetGUIDLow(), itr->first);
+            ++m_saveRowCount;
+        }
 
         // add only changed/new not dependent spells
         if (!playerSpell.dependent && (playerSpell.state == PLAYERSPELL_NEW || playerSpell.state == PLAYERSPELL_CHANGED))
+        {
             stmtIns.PExecute(GetGUIDLow(), itr->first, uint8(playerSpell.active ? 1 : 0), uint8(playerSpell.disabled ? 1 : 0));
+            ++m_saveRowCount;
+        }
 
         if (playerSpell.state == PLAYERSPELL_REMOVED)
             m_spells.erase(itr++);
@@ -17303,6 +17441,7 @@ void Player::SavePositionInDB(ObjectGuid guid, uint32 mapid, float x, float y, f
        << "transguid='0',taxi_path='' WHERE guid='" << guid.GetCounter() << "'";
     DEBUG_LOG("%s", ss.str().c_str());
     CharacterDatabase.Execute(ss.str().c_str());
+    sCharacterEnumCache.InvalidateCharacter(guid.GetCounter());
 }
 
 void Player::SetUInt32ValueInArray(Tokens& tokens, uint16 index, uint32 value)
@@ -21252,7 +21391,10 @@ void Player::RemoveAtLoginFlag(AtLoginFlags f, bool in_db_also /*= false*/)
     m_atLoginFlags &= ~f;
 
     if (in_db_also)
+    {
         CharacterDatabase.PExecute("UPDATE characters set at_login = at_login & ~ %u WHERE guid ='%u'", uint32(f), GetGUIDLow());
+        sCharacterEnumCache.InvalidateAccount(GetSession()->GetAccountId());
+    }
 }
 
 void Player::SendClearCooldown(uint32 spell_id, Unit* target) const
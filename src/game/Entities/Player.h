@@ -42,7 +42,10 @@
 #include "Loot/LootMgr.h"
 #include "Cinematics/CinematicMgr.h"
 
+#include <array>
+#include <deque>
 #include <functional>
+#include <tuple>
 #include <vector>
 
 struct Mail;
@@ -905,6 +908,7 @@ class Player : public Unit
 {
         friend class WorldSession;
         friend class CinematicMgr;
+        friend class CPlayer;
 
         friend void Item::AddToUpdateQueueOf(Player* player);
         friend void Item::RemoveFromUpdateQueueOf(Player* player);
@@ -1395,8 +1399,11 @@ class Player : public Unit
         static void SavePositionInDB(ObjectGuid guid, uint32 mapid, float x, float y, float z, float o, uint32 zone);
 
         static void DeleteFromDB(ObjectGuid playerguid, uint32 accountId, bool updateRealmChars = true, bool deleteFinally = false);
+        typedef std::deque<std::pair<uint32 /*guidLow*/, uint32 /*accountId*/>> OldCharacterQueue;
         static void DeleteOldCharacters();
         static void DeleteOldCharacters(uint32 keepDays);
+        static void SelectOldCharacters(uint32 keepDays, OldCharacterQueue& characters);
+        static void ReadOldCharacters(QueryResult* result, OldCharacterQueue& characters);
 
         bool m_mailsUpdated;
 
@@ -2337,6 +2344,18 @@ class Player : public Unit
         void _SaveBGData();
         void _SaveStats();
 
+        // rows written by last save, used to only write changed aura and cooldown rows
+        typedef std::tuple<uint64 /*caster_guid*/, uint32 /*item_guid*/, uint32 /*spell*/> SavedAuraKey;
+        typedef std::array<int64, 11> SavedAuraRow;         // stackcount, remaincharges, basepoints0-2, periodictime0-2, maxduration, remaintime, effIndexMask
+        typedef std::map<SavedAuraKey, SavedAuraRow> SavedAuraMap;
+        typedef std::array<uint64, 4> SavedCooldownRow;     // SpellExpireTime, Category, CategoryExpireTime, ItemId
+        typedef std::map<uint32 /*SpellId*/, SavedCooldownRow> SavedCooldownMap;
+
+        SavedAuraMap m_savedAuras;
+        SavedCooldownMap m_savedCooldowns;
+        bool m_savedRowsSynced;                             // false until a full save wrote m_savedAuras/m_savedCooldowns
+        uint32 m_saveRowCount;                              // rows written by current save
+
         void _SetCreateBits(UpdateMask* updateMask, Player* target) const override;
         void _SetUpdateBits(UpdateMask* updateMask, Player* target) const override;
 
@@ -0,0 +1,142 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Entities/PlayerSaveScheduler.h"
+#include "Entities/Player.h"
+#include "Globals/ObjectAccessor.h"
+#include "Policies/Singleton.h"
+#include "World/World.h"
+#include "Database/DatabaseEnv.h"
+#include "Timer.h"
+#include "Metric/Metric.h"
+
+INSTANTIATE_SINGLETON_1(PlayerSaveScheduler);
+
+#define SAVE_SCHEDULER_SCAN_INTERVAL 1000
+
+PlayerSaveScheduler::PlayerSaveScheduler() : m_scanTimer(0), m_tokens(0.0f), m_online(0), m_metricTime(0), m_saved(0), m_forced(0), m_backoffScans(0)
+{
+}
+
+void PlayerSaveScheduler::Update(uint32 diff)
+{
+    uint32 interval = sWorld.getConfig(CONFIG_UINT32_INTERVAL_SAVE);
+    if (!sWorld.getConfig(CONFIG_BOOL_PLAYER_SAVE_SCHEDULER) || !interval)
+    {
+        m_due.clear();
+        return;
+    }
+
+    m_scanTimer += diff;
+    if (m_scanTimer < SAVE_SCHEDULER_SCAN_INTERVAL)
+        return;
+
+    uint32 elapsed = m_scanTimer;
+    m_scanTimer = 0;
+
+    uint32 now = WorldTimer::getMSTime();
+    uint32 online = 0;
+    std::vector<std::pair<Player*, uint32 /*dueSince*/>> due;
+    DueMap stillDue;
+
+    sObjectAccessor.ExecuteOnAllPlayers([&](Player* player)
+    {
+        if (!player->IsInWorld())
+            return;
+
+        ++online;
+
+        // timer is stopped at 0 by Player::Update and restarted by SaveToDB
+        if (player->GetSaveTimer())
+            return;
+
+        DueMap::const_iterator itr = m_due.find(player->GetGUIDLow());
+        uint32 dueSince = itr != m_due.end() ? itr->second : now;
+        stillDue.emplace(player->GetGUIDLow(), dueSince);
+        due.emplace_back(player, dueSince);
+    });
+
+    m_due = std::move(stillDue);
+
+    m_online = online;
+    m_metricTime += elapsed;
+
+    // refill at the rate needed to save every online player once per interval,
+    // burst only limits how much is caught up after idling, not that rate
+    float refill = float(online) * elapsed / interval;
+    float burst = std::max(float(sWorld.getConfig(CONFIG_UINT32_PLAYER_SAVE_SCHEDULER_BURST)), refill);
+    bool backoff = CharacterDatabase.GetDelayQueueSize() >= sWorld.getConfig(CONFIG_UINT32_PLAYER_SAVE_SCHEDULER_DB_QUEUE);
+    if (backoff)
+        ++m_backoffScans;
+    else
+        m_tokens = std::min(m_tokens + refill, burst);
+
+    if (due.empty())
+        return;
+
+    // most pending item changes first, then longest waiting
+    std::sort(due.begin(), due.end(), [now](std::pair<Player*, uint32> const& a, std::pair<Player*, uint32> const& b)
+    {
+        size_t aChanges = a.first->GetItemUpdateQueue().size();
+        size_t bChanges = b.first->GetItemUpdateQueue().size();
+        if (aChanges != bChanges)
+            return aChanges > bChanges;
+        return WorldTimer::getMSTimeDiff(a.second, now) > WorldTimer::getMSTimeDiff(b.second, now);
+    });
+
+    for (auto const& entry : due)
+    {
+        Player* player = entry.first;
+        bool forced = WorldTimer::getMSTimeDiff(entry.second, now) >= interval;
+        if (!forced && (backoff || m_tokens < 1.0f))
+            continue;
+
+        if (forced)
+            ++m_forced;
+        else
+            m_tokens -= 1.0f;
+
+        // m_nextSave restarted in SaveToDB call
+        player->SaveToDB();
+        m_due.erase(player->GetGUIDLow());
+        ++m_saved;
+        DETAIL_LOG("Player '%s' (GUID: %u) saved", player->GetName(), player->GetGUIDLow());
+    }
+}
+
+void PlayerSaveScheduler::GenerateMetrics()
+{
+    if (!sWorld.getConfig(CONFIG_BOOL_PLAYER_SAVE_SCHEDULER))
+        return;
+
+    metric::measurement meas("world.metrics.playersave");
+    // in steady state saved matches expected, the online players' share of the save interval
+    uint32 interval = sWorld.getConfig(CONFIG_UINT32_INTERVAL_SAVE);
+    meas.add_field("online", std::to_string(m_online));
+    meas.add_field("expected", std::to_string(interval ? uint64(m_online) * m_metricTime / interval : 0));
+    meas.add_field("saved", std::to_string(m_saved));
+    meas.add_field("forced", std::to_string(m_forced));
+    meas.add_field("backoff", std::to_string(m_backoffScans));
+    meas.add_field("due", std::to_string(m_due.size()));
+    meas.add_field("db_queue", std::to_string(CharacterDatabase.GetDelayQueueSize()));
+
+    m_metricTime = 0;
+    m_saved = 0;
+    m_forced = 0;
+    m_backoffScans = 0;
+}
@@ -0,0 +1,55 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _PLAYERSAVESCHEDULER_H
+#define _PLAYERSAVESCHEDULER_H
+
+#include "Common.h"
+
+/// Replaces the per player autosave timers by a world wide rotation. Players whose save timer ran out
+/// are saved from the world thread at a token bucket limited rate of online players per save interval,
+/// players with most pending item changes first. Saving pauses while the character db delay queue is
+/// too long, a player is only saved out of turn after waiting for a whole extra save interval.
+class PlayerSaveScheduler
+{
+        typedef std::unordered_map<uint32 /*guidLow*/, uint32 /*dueSince*/> DueMap;
+
+    public:
+        PlayerSaveScheduler();
+
+        // called from world thread while maps are not updated
+        void Update(uint32 diff);
+
+        void GenerateMetrics();
+
+    private:
+        uint32 m_scanTimer;
+        float m_tokens;
+        DueMap m_due;
+        uint32 m_online;
+
+        // stats since last metric
+        uint32 m_metricTime;
+        uint32 m_saved;
+        uint32 m_forced;
+        uint32 m_backoffScans;
+};
+
+#define sPlayerSaveScheduler MaNGOS::Singleton<PlayerSaveScheduler>::Instance()
+
+#endif // _PLAYERSAVESCHEDULER_H
@@ -347,6 +347,7 @@ Unit::Unit() :
 
     m_Visibility = VISIBILITY_ON;
     m_AINotifyEvent = nullptr;
+    m_dormant = false;
 
     m_transform = 0;
     m_canModifyStats = false;
@@ -4297,6 +4298,8 @@ void Unit::SetCurrentCastedSpell(Spell* newSpell)
 
     if (newSpell == m_currentSpells[CSpellType]) return;      // avoid breaking self
 
+    WakeUp();
+
     // break same type spell if it is not delayed
     InterruptSpell(CSpellType, false);
 
@@ -4706,6 +4709,8 @@ int32 Unit::GetMaxNegativeAuraModifierByMiscValue(AuraType auratype, int32 misc_
 
 bool Unit::AddSpellAuraHolder(SpellAuraHolder* holder)
 {
+    WakeUp();
+
     SpellEntry const* aurSpellInfo = holder->GetSpellProto();
 
     // ghost spell check, allow apply any auras at player loading in ghost mode (will be cleanup after load)
@@ -4870,6 +4875,7 @@ bool Unit::AddSpellAuraHolder(SpellAuraHolder* holder)
     if (m_spellUpdateHappening)
         holder->SetCreationDelayFlag();
     m_spellAuraHolders.insert(SpellAuraHolderMap::value_type(holder->GetId(), holder));
+    m_procAuraHolders.Add(holder);
 
     for (int32 i = 0; i < MAX_EFFECT_INDEX; ++i)
         if (Aura* aur = holder->GetAuraByEffectIndex(SpellEffectIndex(i)))
@@ -5406,6 +5412,7 @@ void Unit::RemoveSpellAuraHolder(SpellAuraHolder* holder, AuraRemoveMode mode)
             break;
         }
     }
+    m_procAuraHolders.Remove(holder);
 
     holder->SetRemoveMode(mode);
     holder->UnregisterAndCleanupTrackedAuras();
@@ -8210,6 +8217,8 @@ void Unit::SetInCombatState(bool PvP, Unit* enemy)
     if (!IsAlive())
         return;
 
+    WakeUp();
+
     bool notInCombat = !HasFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_IN_COMBAT);
     bool creatureNotInCombat = GetTypeId() == TYPEID_UNIT && notInCombat;
 
@@ -9504,6 +9513,8 @@ void Unit::SetHealth(uint32 val)
     uint32 maxHealth = GetMaxHealth();
     if (maxHealth < val)
         val = maxHealth;
+    else if (val < maxHealth)
+        WakeUp();                                           // needs regeneration
 
     SetUInt32Value(UNIT_FIELD_HEALTH, val);
 
@@ -9557,6 +9568,8 @@ void Unit::SetPower(Powers power, uint32 val)
     uint32 maxPower = GetMaxPower(power);
     if (maxPower < val)
         val = maxPower;
+    else if (val < maxPower)
+        WakeUp();                                           // needs regeneration
 
     SetStatInt32Value(UNIT_FIELD_POWER1 + power, val);
 
@@ -11170,6 +11183,8 @@ class UnitVisitObjectsInRangeNotifyEvent : public BasicEvent
 
 void Unit::ScheduleAINotify(uint32 delay, bool forced)
 {
+    WakeUp();
+
     if (!IsAINotifyScheduled())
     {
         m_AINotifyEvent = new UnitVisitObjectsInRangeNotifyEvent(*this);
@@ -11935,11 +11950,16 @@ void Unit::InterruptSpellsCastedOnMe(bool killDelayed)
         if (!killDelayed)
             continue;
         // 2/ Interrupt spells that are not referenced but that still have an event (like delayed spell)
-        for (auto i_events = target->m_events.GetEvents().begin(); i_events != target->m_events.GetEvents().end(); ++i_events)
-            if (SpellEvent* event = dynamic_cast<SpellEvent*>(i_events->second))
-                if (event && event->GetSpell()->m_targets.getUnitTargetGuid() == GetObjectGuid())
-                    if (event->GetSpell()->getState() != SPELL_STATE_FINISHED)
-                        event->GetSpell()->cancel();
+        // collected first, cancel() may add events and so invalidate the event list iterators
+        std::vector<SpellEvent*> spellEvents;
+        for (auto const& queued : target->m_events.GetEvents())
+            if (SpellEvent* event = dynamic_cast<SpellEvent*>(queued.second))
+                if (event->GetSpell()->m_targets.getUnitTargetGuid() == GetObjectGuid())
+                    spellEvents.push_back(event);
+
+        for (SpellEvent* event : spellEvents)
+            if (event->GetSpell()->getState() != SPELL_STATE_FINISHED)
+                event->GetSpell()->cancel();
     }
 }
 
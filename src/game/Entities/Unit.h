@@ -30,6 +30,7 @@
 #include "Entities/Object.h"
 #include "Server/Opcodes.h"
 #include "Spells/SpellAuraDefines.h"
+#include "Spells/AuraProcIndex.h"
 #include "Entities/UpdateFields.h"
 #include "Globals/SharedDefines.h"
 #include "Combat/ThreatManager.h"
@@ -721,11 +722,13 @@ class MovementInfo
         Position const* GetTransportPos() const { return &t_pos; }
         uint32 GetTransportTime() const { return t_time; }
         uint32 GetFallTime() const { return fallTime; }
+        void SetFallTime(uint32 _fallTime) { fallTime = _fallTime; }
         void ChangeOrientation(float o) { pos.o = o; }
         void ChangePosition(float x, float y, float z, float o) { pos.x = x; pos.y = y; pos.z = z; pos.o = o; }
         void UpdateTime(uint32 _time) { time = _time; }
         uint32 GetTime() const { return time; }
         uint32 GetACTime() const { return acTime; }
+        void SetACTime(uint32 _acTime) { acTime = _acTime; }
 
         struct JumpInfo
         {
@@ -734,6 +737,7 @@ class MovementInfo
         };
 
         JumpInfo const& GetJumpInfo() const { return jump; }
+        void SetJumpInfo(JumpInfo const& _jump) { jump = _jump; }
     private:
         // common
         uint32   moveFlags;                                 // see enum MovementFlags
@@ -2236,6 +2240,7 @@ class Unit : public WorldObject
         SpellAuraHolderMap&       GetSpellAuraHolderMap()       { return m_spellAuraHolders; }
         SpellAuraHolderMap const& GetSpellAuraHolderMap() const { return m_spellAuraHolders; }
         AuraList const& GetAurasByType(AuraType type) const { return m_modAuras[type]; }
+        uint32 GetAuraProcFlagMask() const { return m_procAuraHolders.GetProcFlagMask(); }
         void ApplyAuraProcTriggerDamage(Aura* aura, bool apply);
 
         int32 GetTotalAuraModifier(AuraType auratype) const;
@@ -2444,6 +2449,10 @@ class Unit : public WorldObject
         void AbortAINotifyEvent();
         void OnRelocated();
 
+        // creature skipping its updates while idle, cleared by every state change that needs updates again
+        bool IsDormant() const { return m_dormant; }
+        void WakeUp() { m_dormant = false; }
+
         bool IsLinkingEventTrigger() const { return m_isCreatureLinkingTrigger; }
         void TriggerAggroLinkingEvent(Unit* enemy);
 
@@ -2566,6 +2575,7 @@ class Unit : public WorldObject
         SpellAuraHolderMap::iterator m_spellAuraHoldersUpdateIterator; // != end() in Unit::m_spellAuraHolders update and point to next element
         AuraList m_deletedAuras;                            // auras removed while in ApplyModifier and waiting deleted
         SpellAuraHolderList m_deletedHolders;
+        AuraProcIndex<SpellAuraHolder> m_procAuraHolders;   // holders with proc flags
         std::map<uint32, Aura*> m_classScripts;
         std::vector<Aura*> m_scriptedLocations[SCRIPT_LOCATION_MAX];
         std::vector<Aura*> m_scalingAuras;
@@ -2647,6 +2657,9 @@ class Unit : public WorldObject
         ObjectGuid const& GetCritterGuid() const { return m_critterGuid; }
         void SetCritterGuid(ObjectGuid critterGuid) { m_critterGuid = critterGuid; }
 
+    protected:
+        bool m_dormant;                                     // see IsDormant()
+
     private:
         void CleanupDeletedAuras();
         void UpdateSplineMovement(uint32 t_diff);
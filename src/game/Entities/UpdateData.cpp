@@ -60,29 +60,72 @@ void UpdateData::AddUpdateBlock(const ByteBuffer& block)
     }
 }
 
-void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
+namespace
 {
-    z_stream c_stream;
+    // deflate state of a thread, reset for every packet instead of set up anew
+    struct UpdateCompressionStream
+    {
+        z_stream stream;
+        int level = -1;
+
+        ~UpdateCompressionStream()
+        {
+            if (level >= 0)
+                deflateEnd(&stream);
+        }
+
+        z_stream* Get(int wantedLevel)
+        {
+            if (level == wantedLevel)
+            {
+                int z_res = deflateReset(&stream);
+                if (z_res == Z_OK)
+                    return &stream;
+
+                sLog.outError("Can't compress update packet (zlib: deflateReset) Error code: %i (%s)", z_res, zError(z_res));
+            }
+
+            if (level >= 0)                                 // compression level changed at config reload
+                deflateEnd(&stream);
+            level = -1;
+
+            stream.zalloc = (alloc_func)nullptr;
+            stream.zfree = (free_func)nullptr;
+            stream.opaque = (voidpf)nullptr;
+
+            int z_res = deflateInit(&stream, wantedLevel);
+            if (z_res != Z_OK)
+            {
+                sLog.outError("Can't compress update packet (zlib: deflateInit) Error code: %i (%s)", z_res, zError(z_res));
+                return nullptr;
+            }
+
+            level = wantedLevel;
+            return &stream;
+        }
+    };
+}
 
-    c_stream.zalloc = (alloc_func)nullptr;
-    c_stream.zfree = (free_func)nullptr;
-    c_stream.opaque = (voidpf)nullptr;
+void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
+{
+    thread_local UpdateCompressionStream compression;
 
     // default Z_BEST_SPEED (1)
-    int z_res = deflateInit(&c_stream, sWorld.getConfig(CONFIG_UINT32_COMPRESSION));
-    if (z_res != Z_OK)
+    z_stream* c_stream_ptr = compression.Get(sWorld.getConfig(CONFIG_UINT32_COMPRESSION));
+    if (!c_stream_ptr)
     {
-        sLog.outError("Can't compress update packet (zlib: deflateInit) Error code: %i (%s)", z_res, zError(z_res));
         *dst_size = 0;
         return;
     }
 
+    z_stream& c_stream = *c_stream_ptr;
+
     c_stream.next_out = (Bytef*)dst;
     c_stream.avail_out = *dst_size;
     c_stream.next_in = (Bytef*)src;
     c_stream.avail_in = (uInt)src_size;
 
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
+    int z_res = deflate(&c_stream, Z_NO_FLUSH);
     if (z_res != Z_OK)
     {
         sLog.outError("Can't compress update packet (zlib: deflate) Error code: %i (%s)", z_res, zError(z_res));
@@ -105,14 +148,6 @@ void UpdateData::Compress(void* dst, uint32* dst_size, void* src, int src_size)
         return;
     }
 
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK)
-    {
-        sLog.outError("Can't compress update packet (zlib: deflateEnd) Error code: %i (%s)", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
     *dst_size = c_stream.total_out;
 }
 
@@ -21,6 +21,8 @@
 
 #include "Errors.h"
 
+#include <algorithm>
+
 class UpdateMask
 {
     public:
@@ -47,6 +49,44 @@ class UpdateMask
             return (((uint8*)mUpdateMask)[ index >> 3 ] & (1 << (index & 0x7))) != 0;
         }
 
+        // sets the bits 64 * word .. 64 * word + 63 that are set in bits
+        void SetBits64(uint32 word, uint64 bits)
+        {
+            uint8* mask = (uint8*)mUpdateMask;
+            for (uint32 i = word * 8, end = std::min(i + 8, GetLength()); i < end && bits; ++i, bits >>= 8)
+                mask[i] |= uint8(bits);
+        }
+
+        // index of the first set bit at or after index, GetCount() if there is none
+        uint32 GetNextBit(uint32 index) const
+        {
+            uint8 const* mask = (uint8 const*)mUpdateMask;
+            uint32 byte = index >> 3;
+            uint32 const length = GetLength();
+            if (byte >= length)
+                return mCount;
+
+            // rest of the current byte
+            if (uint8 bits = mask[byte] >> (index & 0x7))
+                return std::min(index + LowestBit(bits), mCount);
+
+            // skip empty bytes up to the next block, then empty blocks
+            for (++byte; byte < length && (byte & 0x3); ++byte)
+                if (mask[byte])
+                    return std::min((byte << 3) + LowestBit(mask[byte]), mCount);
+
+            for (uint32 block = byte >> 2; block < mBlocks; ++block)
+            {
+                if (!mUpdateMask[block])
+                    continue;
+
+                for (byte = block << 2; !mask[byte]; ++byte) {}
+                return std::min((byte << 3) + LowestBit(mask[byte]), mCount);
+            }
+
+            return mCount;
+        }
+
         uint32 GetBlockCount() const { return mBlocks; }
         uint32 GetLength() const { return mBlocks << 2; }
         uint32 GetCount() const { return mCount; }
@@ -112,6 +152,17 @@ class UpdateMask
         }
 
     private:
+        static uint32 LowestBit(uint8 bits)
+        {
+            uint32 bit = 0;
+            while (!(bits & 1))
+            {
+                bits >>= 1;
+                ++bit;
+            }
+            return bit;
+        }
+
         uint32 mCount;
         uint32 mBlocks;
         uint32* mUpdateMask;
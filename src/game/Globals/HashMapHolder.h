@@ -0,0 +1,70 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_HASHMAPHOLDER_H
+#define MANGOS_HASHMAPHOLDER_H
+
+#include "Common.h"
+#include "Entities/ObjectGuid.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+template <class T>
+class HashMapHolder
+{
+    public:
+
+        typedef std::unordered_map<ObjectGuid, T*>   MapType;
+        typedef std::shared_mutex LockType;
+        typedef std::shared_lock<std::shared_mutex> ReadGuard;
+        typedef std::unique_lock<std::shared_mutex> WriteGuard;
+
+        static void Insert(T* o);
+
+        static void Remove(T* o);
+
+        static T* Find(ObjectGuid guid);
+
+        // whole container for iteration under GetLock(), lookups by guid go through the shards
+        static MapType& GetContainer();
+
+        static LockType& GetLock();
+
+    private:
+
+        // Non instanceable only static
+        HashMapHolder() {}
+
+        // Find only takes the shared lock of one shard, so map threads looking up
+        // different objects do not contend on (or bounce the cache line of) a single lock
+        static const size_t SHARD_COUNT = 16;
+        struct alignas(64) Shard
+        {
+            LockType lock;
+            MapType objects;
+        };
+        static Shard& GetShard(ObjectGuid guid) { return m_shards[std::hash<ObjectGuid>()(guid) % SHARD_COUNT]; }
+
+        static LockType i_lock;
+        static MapType  m_objectMap;
+        static Shard    m_shards[SHARD_COUNT];
+};
+
+#endif
@@ -0,0 +1,65 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_HASHMAPHOLDERIMPL_H
+#define MANGOS_HASHMAPHOLDERIMPL_H
+
+#include "Globals/HashMapHolder.h"
+
+template<class T>
+void HashMapHolder<T>::Insert(T* o)
+{
+    Shard& shard = GetShard(o->GetObjectGuid());
+    WriteGuard guard(i_lock);
+    WriteGuard shardGuard(shard.lock);
+    m_objectMap[o->GetObjectGuid()] = o;
+    shard.objects[o->GetObjectGuid()] = o;
+}
+
+template<class T>
+void HashMapHolder<T>::Remove(T* o)
+{
+    Shard& shard = GetShard(o->GetObjectGuid());
+    WriteGuard guard(i_lock);
+    WriteGuard shardGuard(shard.lock);
+    m_objectMap.erase(o->GetObjectGuid());
+    shard.objects.erase(o->GetObjectGuid());
+}
+
+template<class T>
+T* HashMapHolder<T>::Find(ObjectGuid guid)
+{
+    Shard& shard = GetShard(guid);
+    ReadGuard guard(shard.lock);
+    typename MapType::iterator itr = shard.objects.find(guid);
+    return (itr != shard.objects.end()) ? itr->second : nullptr;
+}
+
+template<class T>
+typename HashMapHolder<T>::MapType& HashMapHolder<T>::GetContainer() { return m_objectMap; }
+
+template<class T>
+typename HashMapHolder<T>::LockType& HashMapHolder<T>::GetLock() { return i_lock; }
+
+/// Define the static member of HashMapHolder
+
+template <class T> typename HashMapHolder<T>::MapType HashMapHolder<T>::m_objectMap;
+template <class T> std::shared_mutex HashMapHolder<T>::i_lock;
+template <class T> typename HashMapHolder<T>::Shard HashMapHolder<T>::m_shards[HashMapHolder<T>::SHARD_COUNT];
+
+#endif
@@ -27,6 +27,7 @@
 #include "Grids/CellImpl.h"
 #include "Grids/GridNotifiersImpl.h"
 #include "Entities/ObjectGuid.h"
+#include "Globals/HashMapHolderImpl.h"
 #include "World/World.h"
 
 #include <mutex>
@@ -35,34 +36,6 @@
 INSTANTIATE_SINGLETON_2(ObjectAccessor, CLASS_LOCK);
 INSTANTIATE_CLASS_MUTEX(ObjectAccessor, std::mutex);
 
-template<class T>
-void HashMapHolder<T>::Insert(T* o)
-{
-    WriteGuard guard(i_lock);
-    m_objectMap[o->GetObjectGuid()] = o;
-}
-
-template<class T>
-void HashMapHolder<T>::Remove(T* o)
-{
-    WriteGuard guard(i_lock);
-    m_objectMap.erase(o->GetObjectGuid());
-}
-
-template<class T>
-T* HashMapHolder<T>::Find(ObjectGuid guid)
-{
-    ReadGuard guard(i_lock);
-    typename MapType::iterator itr = m_objectMap.find(guid);
-    return (itr != m_objectMap.end()) ? itr->second : nullptr;
-}
-
-template<class T>
-typename HashMapHolder<T>::MapType& HashMapHolder<T>::GetContainer() { return m_objectMap; }
-
-template<class T>
-typename HashMapHolder<T>::LockType& HashMapHolder<T>::GetLock() { return i_lock; }
-
 ObjectAccessor::ObjectAccessor() {}
 ObjectAccessor::~ObjectAccessor()
 {
@@ -113,13 +86,31 @@ Player* ObjectAccessor::FindPlayer(ObjectGuid guid, bool inWorld /*= true*/)
 
 Player* ObjectAccessor::FindPlayerByName(const char* name)
 {
-    HashMapHolder<Player>::ReadGuard g(HashMapHolder<Player>::GetLock());
-    HashMapHolder<Player>::MapType& m = sObjectAccessor.GetPlayers();
-    for (HashMapHolder<Player>::MapType::iterator iter = m.begin(); iter != m.end(); ++iter)
-        if (iter->second->IsInWorld() && (::strcmp(name, iter->second->GetName()) == 0))
-            return iter->second;
+    ObjectAccessor& accessor = sObjectAccessor;
+    std::shared_lock<std::shared_mutex> guard(accessor.i_playerNameGuard);
+    auto itr = accessor.i_playersByName.find(name);
+    if (itr == accessor.i_playersByName.end() || !itr->second->IsInWorld())
+        return nullptr;
 
-    return nullptr;
+    return itr->second;
+}
+
+void ObjectAccessor::AddObject(Player* object)
+{
+    HashMapHolder<Player>::Insert(object);
+
+    std::unique_lock<std::shared_mutex> guard(i_playerNameGuard);
+    i_playersByName[object->GetName()] = object;
+}
+
+void ObjectAccessor::RemoveObject(Player* object)
+{
+    HashMapHolder<Player>::Remove(object);
+
+    std::unique_lock<std::shared_mutex> guard(i_playerNameGuard);
+    auto itr = i_playersByName.find(object->GetName());
+    if (itr != i_playersByName.end() && itr->second == object)
+        i_playersByName.erase(itr);
 }
 
 void ObjectAccessor::SaveAllPlayers() const
@@ -284,7 +275,7 @@ ObjectAccessor::ConvertCorpseForPlayer(ObjectGuid player_guid, bool insignia)
     return bones;
 }
 
-void ObjectAccessor::RemoveOldCorpses()
+bool ObjectAccessor::RemoveOldCorpses(TimeBudget const& budget)
 {
     time_t now = time(nullptr);
     Player2CorpsesMapType::iterator next;
@@ -297,13 +288,13 @@ void ObjectAccessor::RemoveOldCorpses()
             continue;
 
         ConvertCorpseForPlayer(itr->first);
-    }
-}
 
-/// Define the static member of HashMapHolder
+        if (budget.Exceeded())
+            return false;
+    }
 
-template <class T> typename HashMapHolder<T>::MapType HashMapHolder<T>::m_objectMap;
-template <class T> std::mutex HashMapHolder<T>::i_lock;
+    return true;
+}
 
 /// Global definitions for the hashmap storage
 
@@ -30,6 +30,8 @@
 #include "Entities/Object.h"
 #include "Entities/Player.h"
 #include "Entities/Corpse.h"
+#include "Timer.h"
+#include "Globals/HashMapHolder.h"
 
 #include <functional>
 #include <mutex>
@@ -38,35 +40,6 @@ class Unit;
 class WorldObject;
 class Map;
 
-template <class T>
-class HashMapHolder
-{
-    public:
-
-        typedef std::unordered_map<ObjectGuid, T*>   MapType;
-        typedef std::mutex LockType;
-        typedef std::lock_guard<std::mutex> ReadGuard;
-        typedef std::lock_guard<std::mutex> WriteGuard;
-
-        static void Insert(T* o);
-
-        static void Remove(T* o);
-
-        static T* Find(ObjectGuid guid);
-
-        static MapType& GetContainer();
-
-        static LockType& GetLock();
-
-    private:
-
-        // Non instanceable only static
-        HashMapHolder() {}
-
-        static LockType i_lock;
-        static MapType  m_objectMap;
-};
-
 class ObjectAccessor : public MaNGOS::Singleton<ObjectAccessor, MaNGOS::ClassLevelLockable<ObjectAccessor, std::mutex> >
 {
         friend class MaNGOS::OperatorNew<ObjectAccessor>;
@@ -103,18 +76,23 @@ class ObjectAccessor : public MaNGOS::Singleton<ObjectAccessor, MaNGOS::ClassLev
         void AddCorpse(Corpse* corpse);
         void AddCorpsesToGrid(GridPair const& gridpair, GridType& grid, Map* map);
         Corpse* ConvertCorpseForPlayer(ObjectGuid player_guid, bool insignia = false);
-        void RemoveOldCorpses();
+        // false if stopped by budget with expired corpses left
+        bool RemoveOldCorpses(TimeBudget const& budget);
 
         // For call from Player/Corpse AddToWorld/RemoveFromWorld only
         void AddObject(Corpse* object) { HashMapHolder<Corpse>::Insert(object); }
-        void AddObject(Player* object) { HashMapHolder<Player>::Insert(object); }
+        void AddObject(Player* object);
         void RemoveObject(Corpse* object) { HashMapHolder<Corpse>::Remove(object); }
-        void RemoveObject(Player* object) { HashMapHolder<Player>::Remove(object); }
+        void RemoveObject(Player* object);
 
     private:
 
         Player2CorpsesMapType   i_player2corpse;
 
+        // FindPlayerByName lookups without scanning all players
+        std::unordered_map<std::string, Player*> i_playersByName;
+        std::shared_mutex i_playerNameGuard;
+
         typedef std::mutex LockType;
         typedef MaNGOS::GeneralLock<LockType > Guard;
 
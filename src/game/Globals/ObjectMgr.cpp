@@ -426,6 +426,8 @@ struct SQLCreatureLoader : public SQLStorageLoaderBase<SQLCreatureLoader, SQLSto
     {
         dst = D(sScriptDevAIMgr.GetScriptId(src));
     }
+
+    std::string GetSnapshotDependency() const { return sScriptDevAIMgr.GetScriptNamesKey(); }
 };
 
 void ObjectMgr::LoadCreatureTemplates()
@@ -1962,6 +1964,8 @@ struct SQLItemLoader : public SQLStorageLoaderBase<SQLItemLoader, SQLStorage>
     {
         dst = D(sScriptDevAIMgr.GetScriptId(src));
     }
+
+    std::string GetSnapshotDependency() const { return sScriptDevAIMgr.GetScriptNamesKey(); }
 };
 
 void ObjectMgr::LoadItemPrototypes()
@@ -4852,6 +4856,8 @@ struct SQLInstanceLoader : public SQLStorageLoaderBase<SQLInstanceLoader, SQLSto
     {
         dst = D(sScriptDevAIMgr.GetScriptId(src));
     }
+
+    std::string GetSnapshotDependency() const { return sScriptDevAIMgr.GetScriptNamesKey(); }
 };
 
 void ObjectMgr::LoadInstanceTemplate()
@@ -4931,6 +4937,8 @@ struct SQLWorldLoader : public SQLStorageLoaderBase<SQLWorldLoader, SQLStorage>
     {
         dst = D(sScriptDevAIMgr.GetScriptId(src));
     }
+
+    std::string GetSnapshotDependency() const { return sScriptDevAIMgr.GetScriptNamesKey(); }
 };
 
 void ObjectMgr::LoadWorldTemplate()
@@ -5554,7 +5562,8 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         m->messageType = fields[1].GetUInt8();
         m->sender = fields[2].GetUInt32();
         m->receiverGuid = ObjectGuid(HIGHGUID_PLAYER, fields[3].GetUInt32());
-        bool has_items = fields[5].GetBool();
+        m->itemTextId = fields[4].GetUInt32();
+        m->has_items = fields[5].GetBool();
         m->expire_time = (time_t)fields[6].GetUInt64();
         m->deliver_time = 0;
         m->COD = fields[7].GetUInt32();
@@ -5572,7 +5581,7 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
             continue;
         }
         // delete or return mail:
-        if (has_items)
+        if (m->has_items)
         {
             QueryResult* resultItems = CharacterDatabase.PQuery("SELECT item_guid,item_template FROM mail_items WHERE mail_id='%u'", m->messageID);
             if (resultItems)
@@ -5590,37 +5599,11 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 
                 delete resultItems;
             }
-            // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
-            if (m->messageType != MAIL_NORMAL || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
-            {
-                // mail open and then not returned
-                for (auto& item : m->items)
-                    CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid = '%u'", item.item_guid);
-            }
-            else
-            {
-                // mail will be returned:
-                CharacterDatabase.PExecute("UPDATE mail SET sender = '%u', receiver = '%u', expire_time = '" UI64FMTD "', deliver_time = '" UI64FMTD "',cod = '0', checked = '%u' WHERE id = '%u'",
-                                           m->receiverGuid.GetCounter(), m->sender, (uint64)basetime + 30 * DAY, (uint64)basetime, MAIL_CHECK_MASK_RETURNED, m->messageID);
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                {
-                    // update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
-                    CharacterDatabase.PExecute("UPDATE mail_items SET receiver = %u WHERE item_guid = '%u'", m->sender, itr2->item_guid);
-                    CharacterDatabase.PExecute("UPDATE item_instance SET owner_guid = %u WHERE guid = '%u'", m->sender, itr2->item_guid);
-                }
-                delete m;
-                continue;
-            }
         }
 
-        if (m->itemTextId)
-            CharacterDatabase.PExecute("DELETE FROM item_text WHERE id = '%u'", m->itemTextId);
-
-        // deletemail = true;
-        // delmails << m->messageID << ", ";
-        CharacterDatabase.PExecute("DELETE FROM mail WHERE id = '%u'", m->messageID);
+        if (ReturnOrDeleteOldMail(*m, basetime))
+            ++count;
         delete m;
-        ++count;
     }
     while (result->NextRow());
     delete result;
@@ -5629,6 +5612,46 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
     sLog.outString();
 }
 
+/**
+ * Returns an expired mail with items to its sender, or deletes it with its items and text.
+ *
+ * @param m         expired mail, its items must be already added
+ * @param basetime  current time, used as delivery time of returned mail
+ * @returns true if the mail was deleted
+ */
+bool ObjectMgr::ReturnOrDeleteOldMail(Mail const& m, time_t basetime)
+{
+    if (m.has_items)
+    {
+        // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
+        if (m.messageType != MAIL_NORMAL || (m.checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
+        {
+            // mail open and then not returned
+            for (auto const& item : m.items)
+                CharacterDatabase.PExecute("DELETE FROM item_instance WHERE guid = '%u'", item.item_guid);
+        }
+        else
+        {
+            // mail will be returned:
+            CharacterDatabase.PExecute("UPDATE mail SET sender = '%u', receiver = '%u', expire_time = '" UI64FMTD "', deliver_time = '" UI64FMTD "',cod = '0', checked = '%u' WHERE id = '%u'",
+                                       m.receiverGuid.GetCounter(), m.sender, (uint64)basetime + 30 * DAY, (uint64)basetime, MAIL_CHECK_MASK_RETURNED, m.messageID);
+            for (auto const& item : m.items)
+            {
+                // update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
+                CharacterDatabase.PExecute("UPDATE mail_items SET receiver = %u WHERE item_guid = '%u'", m.sender, item.item_guid);
+                CharacterDatabase.PExecute("UPDATE item_instance SET owner_guid = %u WHERE guid = '%u'", m.sender, item.item_guid);
+            }
+            return false;
+        }
+    }
+
+    if (m.itemTextId)
+        CharacterDatabase.PExecute("DELETE FROM item_text WHERE id = '%u'", m.itemTextId);
+
+    CharacterDatabase.PExecute("DELETE FROM mail WHERE id = '%u'", m.messageID);
+    return true;
+}
+
 void ObjectMgr::LoadQuestAreaTriggers()
 {
     mQuestAreaTriggerMap.clear();                           // need for reload case
@@ -6730,6 +6753,8 @@ struct SQLGameObjectLoader : public SQLStorageLoaderBase<SQLGameObjectLoader, SQ
     {
         dst = D(sScriptDevAIMgr.GetScriptId(src));
     }
+
+    std::string GetSnapshotDependency() const { return sScriptDevAIMgr.GetScriptNamesKey(); }
 };
 
 inline void CheckGOLockId(GameObjectInfo const* goInfo, uint32 dataN, uint32 N)
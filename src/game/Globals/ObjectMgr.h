@@ -777,6 +777,7 @@ class ObjectMgr
         }
 
         void ReturnOrDeleteOldMails(bool serverUp);
+        static bool ReturnOrDeleteOldMail(Mail const& m, time_t basetime);
 
         void SetHighestGuids();
 
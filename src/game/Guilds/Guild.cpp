@@ -29,6 +29,7 @@
 #include "Util.h"
 #include "Tools/Language.h"
 #include "World/World.h"
+#include "Entities/CharacterEnumCache.h"
 
 //// MemberSlot ////////////////////////////////////////////
 void MemberSlot::SetMemberStats(Player* player)
@@ -241,6 +242,7 @@ bool Guild::AddMember(ObjectGuid plGuid, uint32 plRank)
 
     CharacterDatabase.PExecute("INSERT INTO guild_member (guildid,guid,\"rank\",pnote,offnote) VALUES ('%u', '%u', '%u','%s','%s')",
                                m_Id, lowguid, newmember.RankId, dbPnote.c_str(), dbOFFnote.c_str());
+    sCharacterEnumCache.InvalidateCharacter(lowguid);
 
     // If player not in game data in data field will be loaded from guild tables, no need to update it!!
     if (pl)
@@ -573,6 +575,7 @@ bool Guild::DelMember(ObjectGuid guid, bool isDisbanding)
     }
 
     CharacterDatabase.PExecute("DELETE FROM guild_member WHERE guid = '%u'", lowguid);
+    sCharacterEnumCache.InvalidateCharacter(lowguid);
 
     if (!isDisbanding)
         UpdateAccountsNumber();
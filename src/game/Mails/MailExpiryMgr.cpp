@@ -0,0 +1,220 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @addtogroup mailing
+ * @{
+ *
+ * @file MailExpiryMgr.cpp
+ * This file contains the code needed for MaNGOS to return or delete expired mails while the server runs.
+ *
+ */
+
+#include "Mails/MailExpiryMgr.h"
+#include "Policies/Singleton.h"
+#include "Database/DatabaseEnv.h"
+#include "Database/DatabaseImpl.h"
+#include "World/World.h"
+#include "Globals/ObjectMgr.h"
+#include "Metric/Metric.h"
+
+INSTANTIATE_SINGLETON_1(MailExpiryMgr);
+
+MailExpiryMgr::MailExpiryMgr() : m_state(MAIL_EXPIRY_IDLE), m_passTime(0), m_lastExpireTime(0), m_lastId(0), m_lastBatchFull(false),
+    m_backlog(0), m_returned(0), m_deleted(0), m_skipped(0)
+{
+}
+
+void MailExpiryMgr::Start()
+{
+    if (m_state != MAIL_EXPIRY_IDLE)
+        return;
+
+    m_passTime = time(nullptr);
+    m_lastExpireTime = 0;
+    m_lastId = 0;
+    m_state = MAIL_EXPIRY_QUERY;
+
+    CharacterDatabase.AsyncPQuery(this, &MailExpiryMgr::HandleBacklogCallback, uint64(m_passTime), "SELECT COUNT(*) FROM mail WHERE expire_time < '" UI64FMTD "'", uint64(m_passTime));
+}
+
+void MailExpiryMgr::QueryNextBatch()
+{
+    m_state = MAIL_EXPIRY_WAITING;
+    m_loggedIn.clear();
+
+    //                                                                      0  1           2      3        4          5         6           7   8       9
+    CharacterDatabase.AsyncPQuery(this, &MailExpiryMgr::HandleMailsCallback, uint64(m_passTime), "SELECT id,messageType,sender,receiver,itemTextId,has_items,expire_time,cod,checked,mailTemplateId FROM mail "
+                                  "WHERE expire_time < '" UI64FMTD "' AND (expire_time > '" UI64FMTD "' OR (expire_time = '" UI64FMTD "' AND id > '%u')) "
+                                  "ORDER BY expire_time, id LIMIT %u",
+                                  uint64(m_passTime), m_lastExpireTime, m_lastExpireTime, m_lastId, sWorld.getConfig(CONFIG_UINT32_MAIL_EXPIRY_BATCH_SIZE));
+}
+
+void MailExpiryMgr::HandleBacklogCallback(QueryResult* result, uint64 passTime)
+{
+    if (!result)
+        return;
+
+    // pass already finished
+    if (passTime != uint64(m_passTime) || m_state == MAIL_EXPIRY_IDLE)
+    {
+        delete result;
+        return;
+    }
+
+    m_backlog = result->Fetch()[0].GetUInt32();
+    delete result;
+}
+
+void MailExpiryMgr::HandleMailsCallback(QueryResult* result, uint64 /*passTime*/)
+{
+    if (!result)
+    {
+        m_lastBatchFull = false;
+        m_state = MAIL_EXPIRY_PROCESS;
+        return;
+    }
+
+    m_lastBatchFull = result->GetRowCount() >= sWorld.getConfig(CONFIG_UINT32_MAIL_EXPIRY_BATCH_SIZE);
+
+    std::ostringstream itemMails;
+    do
+    {
+        Field* fields = result->Fetch();
+        Mail* m = new Mail;
+        m->messageID = fields[0].GetUInt32();
+        m->messageType = fields[1].GetUInt8();
+        m->sender = fields[2].GetUInt32();
+        m->receiverGuid = ObjectGuid(HIGHGUID_PLAYER, fields[3].GetUInt32());
+        m->itemTextId = fields[4].GetUInt32();
+        m->has_items = fields[5].GetBool();
+        m->expire_time = (time_t)fields[6].GetUInt64();
+        m->deliver_time = 0;
+        m->COD = fields[7].GetUInt32();
+        m->checked = fields[8].GetUInt32();
+        m->mailTemplateId = fields[9].GetInt16();
+
+        m_lastExpireTime = fields[6].GetUInt64();
+        m_lastId = m->messageID;
+
+        if (m->has_items)
+            itemMails << (itemMails.tellp() ? "," : "") << m->messageID;
+
+        m_batch.emplace_back(m);
+    }
+    while (result->NextRow());
+    delete result;
+
+    // items of the whole batch by one more query
+    if (itemMails.tellp())
+        CharacterDatabase.AsyncPQuery(this, &MailExpiryMgr::HandleItemsCallback, uint64(m_passTime), "SELECT mail_id,item_guid,item_template FROM mail_items WHERE mail_id IN (%s)", itemMails.str().c_str());
+    else
+        m_state = MAIL_EXPIRY_PROCESS;
+}
+
+void MailExpiryMgr::HandleItemsCallback(QueryResult* result, uint64 /*passTime*/)
+{
+    m_state = MAIL_EXPIRY_PROCESS;
+
+    if (!result)
+        return;
+
+    std::unordered_map<uint32, Mail*> mails;
+    for (auto const& m : m_batch)
+        mails[m->messageID] = m.get();
+
+    do
+    {
+        Field* fields = result->Fetch();
+        auto itr = mails.find(fields[0].GetUInt32());
+        if (itr != mails.end())
+            itr->second->AddItem(fields[1].GetUInt32(), fields[2].GetUInt32());
+    }
+    while (result->NextRow());
+    delete result;
+}
+
+bool MailExpiryMgr::Update(TimeBudget const& budget)
+{
+    switch (m_state)
+    {
+        case MAIL_EXPIRY_IDLE:
+            return true;
+        case MAIL_EXPIRY_QUERY:
+            QueryNextBatch();
+            return false;
+        case MAIL_EXPIRY_WAITING:
+            return false;
+        case MAIL_EXPIRY_PROCESS:
+            break;
+    }
+
+    time_t basetime = time(nullptr);
+
+    while (!m_batch.empty())
+    {
+        std::unique_ptr<Mail> m = std::move(m_batch.front());
+        m_batch.pop_front();
+
+        if (m_backlog)
+            --m_backlog;
+
+        // receiver may have the mail listed already or changed it since it was loaded, it is picked up again by the next pass
+        if (sObjectMgr.GetPlayer(m->receiverGuid) || m_loggedIn.find(m->receiverGuid.GetCounter()) != m_loggedIn.end())
+            ++m_skipped;
+        else if (ObjectMgr::ReturnOrDeleteOldMail(*m, basetime))
+            ++m_deleted;
+        else
+            ++m_returned;
+
+        if (budget.Exceeded())
+            return false;
+    }
+
+    if (m_lastBatchFull)
+    {
+        QueryNextBatch();
+        return false;
+    }
+
+    m_state = MAIL_EXPIRY_IDLE;
+    m_backlog = 0;
+    m_loggedIn.clear();
+    return true;
+}
+
+void MailExpiryMgr::OnPlayerLogin(ObjectGuid guid)
+{
+    if (m_state == MAIL_EXPIRY_WAITING || m_state == MAIL_EXPIRY_PROCESS)
+        m_loggedIn.insert(guid.GetCounter());
+}
+
+void MailExpiryMgr::GenerateMetrics()
+{
+    metric::measurement meas("world.metrics.mailexpiry");
+    meas.add_field("backlog", std::to_string(m_backlog));
+    meas.add_field("returned", std::to_string(m_returned));
+    meas.add_field("deleted", std::to_string(m_deleted));
+    meas.add_field("skipped", std::to_string(m_skipped));
+
+    m_returned = 0;
+    m_deleted = 0;
+    m_skipped = 0;
+}
+
+/*! @} */
@@ -0,0 +1,107 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/**
+ * @addtogroup mailing
+ * @{
+ *
+ * @file MailExpiryMgr.h
+ * This file contains the headers needed for MaNGOS to return or delete expired mails while the server runs,
+ * in batches spread over several world ticks.
+ *
+ */
+
+#ifndef MANGOS_MAIL_EXPIRY_MGR_H
+#define MANGOS_MAIL_EXPIRY_MGR_H
+
+#include "Common.h"
+#include "Mails/Mail.h"
+#include "Timer.h"
+
+#include <unordered_set>
+
+class QueryResult;
+
+/**
+ * A class to walk the mails expired until a pass start along the expire_time index, loading one batch
+ * at a time by async queries and returning or deleting the loaded mails within the world tick housekeeping budget.
+ *
+ * Note: server startup still handles all expired mails at once in ObjectMgr::ReturnOrDeleteOldMails
+ */
+class MailExpiryMgr
+{
+    public:                                                 // Constructors
+        MailExpiryMgr();
+
+    public:                                                 // modifiers
+        /**
+         * Start new pass over all mails expired until now, ignored while a pass is still running
+         */
+        void Start();
+
+        /**
+         * Next step of the running pass: return or delete loaded mails and request next batch
+         *
+         * @returns true when the pass is finished
+         */
+        bool Update(TimeBudget const& budget);
+
+        /**
+         * Receiver logged in: the player's mails of the loaded batch may have been changed and are left to the next pass
+         */
+        void OnPlayerLogin(ObjectGuid guid);
+
+        void GenerateMetrics();
+
+        // async query callbacks, executed in world thread
+        void HandleBacklogCallback(QueryResult* result, uint64 passTime);
+        void HandleMailsCallback(QueryResult* result, uint64 passTime);
+        void HandleItemsCallback(QueryResult* result, uint64 passTime);
+
+    private:
+        enum PassState
+        {
+            MAIL_EXPIRY_IDLE,                               // no pass running
+            MAIL_EXPIRY_QUERY,                              // next batch must be requested
+            MAIL_EXPIRY_WAITING,                            // waiting for batch query results
+            MAIL_EXPIRY_PROCESS,                            // loaded batch is returned/deleted
+        };
+
+        typedef std::deque<std::unique_ptr<Mail>> MailBatch;
+
+        void QueryNextBatch();
+
+        PassState m_state;
+        time_t m_passTime;                                  // mails expired before this time are handled in current pass
+        uint64 m_lastExpireTime;                            // position of last loaded mail in expire_time index
+        uint32 m_lastId;
+        bool m_lastBatchFull;                               // batch was limited by batch size, more mails may be left
+        MailBatch m_batch;
+        std::unordered_set<uint32> m_loggedIn;              // receivers logged in since current batch was requested
+
+        uint32 m_backlog;                                   // expired mails not handled yet in current pass
+        uint32 m_returned;                                  // stats since last metric
+        uint32 m_deleted;
+        uint32 m_skipped;
+};
+
+#define sMailExpiryMgr MaNGOS::Singleton<MailExpiryMgr>::Instance()
+
+#endif
+
+/*! @} */
@@ -24,11 +24,14 @@
 #include "Server/DBCStores.h"
 #include "Maps/GridMap.h"
 #include "VMapFactory.h"
+#include "MapTree.h"
 #include "MotionGenerators/MoveMap.h"
 #include "World/World.h"
 #include "Policies/Singleton.h"
 #include "Util.h"
+#include "Metric/Metric.h"
 
+#include <chrono>
 #include <mutex>
 
 char const* MAP_MAGIC         = "MAPS";
@@ -37,6 +40,23 @@ char const* MAP_AREA_MAGIC    = "AREA";
 char const* MAP_HEIGHT_MAGIC  = "MHGT";
 char const* MAP_LIQUID_MAGIC  = "MLIQ";
 
+static uint32 GetFileSize(std::string const& fileName)
+{
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (!file)
+        return 0;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size > 0 ? uint32(size) : 0;
+}
+
+static uint64 ElapsedMicroseconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
 static uint16 holetab_h[4] = { 0x1111, 0x2222, 0x4444, 0x8888 };
 static uint16 holetab_v[4] = { 0x000F, 0x00F0, 0x0F00, 0xF000 };
 
@@ -67,6 +87,7 @@ GridMap::GridMap(): m_gridIntHeightMultiplier(0)
     m_liquidEntry = nullptr;
     m_liquid_map  = nullptr;
     m_fullyLoaded = false;
+    m_memoryUsage = 0;
 }
 
 GridMap::~GridMap()
@@ -150,6 +171,7 @@ void GridMap::unloadData()
     m_liquidFlags = nullptr;
     m_liquid_map  = nullptr;
     m_gridGetHeight = &GridMap::getHeightFromFlat;
+    m_memoryUsage = 0;
 }
 
 bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
@@ -165,6 +187,7 @@ bool GridMap::loadAreaData(FILE* in, uint32 offset, uint32 /*size*/)
     {
         m_area_map = new uint16 [16 * 16];
         fread(m_area_map, sizeof(uint16), 16 * 16, in);
+        m_memoryUsage += sizeof(uint16) * 16 * 16;
     }
 
     return true;
@@ -189,6 +212,7 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
             fread(m_uint16_V8, sizeof(uint16), 128 * 128, in);
             m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
             m_gridGetHeight = &GridMap::getHeightFromUint16;
+            m_memoryUsage += sizeof(uint16) * (129 * 129 + 128 * 128);
         }
         else if ((header.flags & MAP_HEIGHT_AS_INT8))
         {
@@ -198,6 +222,7 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
             fread(m_uint8_V8, sizeof(uint8), 128 * 128, in);
             m_gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
             m_gridGetHeight = &GridMap::getHeightFromUint8;
+            m_memoryUsage += sizeof(uint8) * (129 * 129 + 128 * 128);
         }
         else
         {
@@ -206,6 +231,7 @@ bool GridMap::loadHeightData(FILE* in, uint32 offset, uint32 /*size*/)
             fread(m_V9, sizeof(float), 129 * 129, in);
             fread(m_V8, sizeof(float), 128 * 128, in);
             m_gridGetHeight = &GridMap::getHeightFromFloat;
+            m_memoryUsage += sizeof(float) * (129 * 129 + 128 * 128);
         }
     }
     else
@@ -247,12 +273,14 @@ bool GridMap::loadGridMapLiquidData(FILE* in, uint32 offset, uint32 /*size*/)
 
         m_liquidFlags = new uint8[16 * 16];
         fread(m_liquidFlags, sizeof(uint8), 16 * 16, in);
+        m_memoryUsage += (sizeof(uint16) + sizeof(uint8)) * 16 * 16;
     }
 
     if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
     {
         m_liquid_map = new float [m_liquid_width * m_liquid_height];
         fread(m_liquid_map, sizeof(float), m_liquid_width * m_liquid_height, in);
+        m_memoryUsage += sizeof(float) * m_liquid_width * m_liquid_height;
     }
 
     return true;
@@ -690,7 +718,7 @@ bool GridMap::ExistVMap(uint32 mapid, int gx, int gy)
 }
 
 //////////////////////////////////////////////////////////////////////////
-TerrainInfo::TerrainInfo(uint32 mapid) : m_mapId(mapid)
+TerrainInfo::TerrainInfo(uint32 mapid) : m_mapId(mapid), m_residentBytes(0), m_clockHand(0)
 {
     for (int k = 0; k < MAX_NUMBER_OF_GRIDS; ++k)
     {
@@ -698,6 +726,9 @@ TerrainInfo::TerrainInfo(uint32 mapid) : m_mapId(mapid)
         {
             m_GridMaps[i][k] = nullptr;
             m_GridRef[i][k] = 0;
+            m_GridAccessed[i][k] = false;
+            for (uint32& bytes : m_GridMemory[i][k])
+                bytes = 0;
         }
     }
 
@@ -716,6 +747,11 @@ TerrainInfo::~TerrainInfo()
         for (auto& m_GridMap : m_GridMaps)
             delete m_GridMap[k];
 
+    for (int k = 0; k < MAX_NUMBER_OF_GRIDS; ++k)
+        for (int i = 0; i < MAX_NUMBER_OF_GRIDS; ++i)
+            for (int source = 0; source < MAX_TERRAIN_SOURCES; ++source)
+                sTerrainMgr.RegisterTileUnload(TerrainTileSource(source), m_GridMemory[i][k][source]);
+
     VMAP::VMapFactory::createOrGetVMapManager()->unloadMap(m_mapId);
     MMAP::MMapFactory::createOrGetMMapManager()->unloadMap(m_mapId);
 }
@@ -727,6 +763,7 @@ GridMap* TerrainInfo::Load(const uint32 x, const uint32 y, bool mapOnly /*= fals
 
     // reference grid as a first step
     RefGrid(x, y);
+    m_GridAccessed[x][y].store(true, std::memory_order_relaxed);
 
     // quick check if GridMap already loaded
     GridMap* pMap = m_GridMaps[x][y];
@@ -759,33 +796,96 @@ void TerrainInfo::CleanUpGrids(const uint32 diff)
     if (!i_timer.Passed())
         return;
 
+    // with a memory budget unreferenced tiles stay cached until TerrainManager needs the memory back
+    if (IsPinned() || sTerrainMgr.GetMemoryBudget())
+    {
+        i_timer.Reset();
+        return;
+    }
+
     for (int y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
     {
         for (int x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
         {
-            const int16& iRef = m_GridRef[x][y];
-            GridMap* pMap = m_GridMaps[x][y];
-
             // delete those GridMap objects which have refcount = 0
-            if (pMap && iRef == 0)
-            {
-                m_GridMaps[x][y] = nullptr;
-                // delete grid data if reference count == 0
-                pMap->unloadData();
-                delete pMap;
-
-                // unload VMAPS...
-                VMAP::VMapFactory::createOrGetVMapManager()->unloadMap(m_mapId, x, y);
-
-                // unload mmap...
-                MMAP::MMapFactory::createOrGetMMapManager()->unloadMap(m_mapId, x, y);
-            }
+            if (m_GridMaps[x][y] && m_GridRef[x][y] == 0)
+                UnloadGrid(x, y);
         }
     }
 
     i_timer.Reset();
 }
 
+uint64 TerrainInfo::EvictGrids(uint64 bytesToFree, bool secondChance)
+{
+    const uint32 gridCount = MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS;
+
+    uint64 freed = 0;
+    for (uint32 i = 0; i < gridCount && freed < bytesToFree; ++i)
+    {
+        const uint32 x = m_clockHand % MAX_NUMBER_OF_GRIDS;
+        const uint32 y = m_clockHand / MAX_NUMBER_OF_GRIDS;
+        m_clockHand = (m_clockHand + 1) % gridCount;
+
+        if (!m_GridMaps[x][y] || m_GridRef[x][y] > 0)
+            continue;
+
+        // recently used tile - clear reference bit and skip it this round
+        if (secondChance && m_GridAccessed[x][y].exchange(false, std::memory_order_relaxed))
+            continue;
+
+        freed += UnloadGrid(x, y, true);
+    }
+
+    return freed;
+}
+
+bool TerrainInfo::IsPinned() const
+{
+    return sWorld.isTerrainPinnedMap(m_mapId);
+}
+
+uint64 TerrainInfo::UnloadGrid(const uint32 x, const uint32 y, bool evicted)
+{
+    GridMap* pMap = m_GridMaps[x][y];
+    m_GridMaps[x][y] = nullptr;
+    m_GridAccessed[x][y] = false;
+
+    // delete grid data
+    pMap->unloadData();
+    delete pMap;
+
+    // unload VMAPS...
+    VMAP::VMapFactory::createOrGetVMapManager()->unloadMap(m_mapId, x, y);
+
+    // unload mmap...
+    MMAP::MMapFactory::createOrGetMMapManager()->unloadMap(m_mapId, x, y);
+
+    uint64 freed = 0;
+    LOCK_GUARD lock(m_mutex);
+    for (int source = 0; source < MAX_TERRAIN_SOURCES; ++source)
+    {
+        uint32& bytes = m_GridMemory[x][y][source];
+        sTerrainMgr.RegisterTileUnload(TerrainTileSource(source), bytes);
+        if (evicted && bytes)
+            sTerrainMgr.RegisterTileEviction(TerrainTileSource(source));
+        freed += bytes;
+        bytes = 0;
+    }
+
+    m_residentBytes -= freed;
+    return freed;
+}
+
+void TerrainInfo::SetGridMemory(const uint32 x, const uint32 y, TerrainTileSource source, uint32 bytes)
+{
+    // caller holds m_mutex, overwrite to stay correct if two threads raced on the same tile load
+    uint32& current = m_GridMemory[x][y][source];
+    sTerrainMgr.RegisterTileUnload(source, current);
+    m_residentBytes += uint64(bytes) - current;
+    current = bytes;
+}
+
 int TerrainInfo::RefGrid(const uint32& x, const uint32& y)
 {
     MANGOS_ASSERT(x < MAX_NUMBER_OF_GRIDS);
@@ -1143,6 +1243,11 @@ GridMap* TerrainInfo::GetGrid(const float x, const float y, bool loadOnlyMap /*=
     int gx = (int)(32 - x / SIZE_OF_GRIDS);                 // grid x
     int gy = (int)(32 - y / SIZE_OF_GRIDS);                 // grid y
 
+    // mark tile as recently used for the CLOCK eviction, avoid dirtying the cache line if already set
+    std::atomic<bool>& accessed = m_GridAccessed[gx][gy];
+    if (!accessed.load(std::memory_order_relaxed))
+        accessed.store(true, std::memory_order_relaxed);
+
     // quick check if GridMap already loaded
     GridMap* pMap = m_GridMaps[gx][gy];
     if (!pMap || (!pMap->IsFullyLoaded() && !loadOnlyMap))
@@ -1165,6 +1270,7 @@ GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnl
         // double checked lock pattern
         if (!m_GridMaps[x][y])
         {
+            auto loadStart = std::chrono::steady_clock::now();
             GridMap* map = new GridMap();
 
             // map file name
@@ -1181,6 +1287,9 @@ GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnl
 
             delete[] tmp;
             m_GridMaps[x][y] = map;
+
+            SetGridMemory(x, y, TERRAIN_SOURCE_MAP, map->GetMemoryUsage());
+            sTerrainMgr.RegisterTileLoad(TERRAIN_SOURCE_MAP, map->GetMemoryUsage(), ElapsedMicroseconds(loadStart));
         }
     }
 
@@ -1194,12 +1303,20 @@ GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnl
         const MapEntry* i_mapEntry = sMapStore.LookupEntry(m_mapId);
         const char* mapName = i_mapEntry ? i_mapEntry->name[sWorld.GetDefaultDbcLocale()] : "UNNAMEDMAP\x0";
 
+        auto loadStart = std::chrono::steady_clock::now();
         int vmapLoadResult = VMAP::VMapFactory::createOrGetVMapManager()->loadMap((sWorld.GetDataPath() + "vmaps").c_str(), m_mapId, x, y);
         switch (vmapLoadResult)
         {
             case VMAP::VMAP_LOAD_RESULT_OK:
+            {
                 DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "VMAP loaded name:%s, id:%d, x:%d, y:%d (vmap rep.: x:%d, y:%d)", mapName, m_mapId, x, y, x, y);
+                // spawns shared with neighbour tiles are accounted to every tile referencing them
+                uint32 bytes = GetFileSize(sWorld.GetDataPath() + "vmaps/" + VMAP::StaticMapTree::getTileFileName(m_mapId, x, y));
+                LOCK_GUARD lock(m_mutex);
+                SetGridMemory(x, y, TERRAIN_SOURCE_VMAP, bytes);
+                sTerrainMgr.RegisterTileLoad(TERRAIN_SOURCE_VMAP, bytes, ElapsedMicroseconds(loadStart));
                 break;
+            }
             case VMAP::VMAP_LOAD_RESULT_ERROR:
                 DEBUG_FILTER_LOG(LOG_FILTER_MAP_LOADING, "Could not load VMAP name:%s, id:%d, x:%d, y:%d (vmap rep.: x:%d, y:%d)", mapName, m_mapId, x, y, x, y);
                 break;
@@ -1212,7 +1329,15 @@ GridMap* TerrainInfo::LoadMapAndVMap(const uint32 x, const uint32 y, bool mapOnl
     if (!MMAP::MMapFactory::createOrGetMMapManager()->IsMMapIsLoaded(m_mapId, x, y))
     {
         // load navmesh
-        MMAP::MMapFactory::createOrGetMMapManager()->loadMap(m_mapId, x, y);
+        auto loadStart = std::chrono::steady_clock::now();
+        MMAP::MMapManager* mmgr = MMAP::MMapFactory::createOrGetMMapManager();
+        if (mmgr->loadMap(m_mapId, x, y))
+        {
+            uint32 bytes = mmgr->GetTileMemoryUsage(m_mapId, x, y);
+            LOCK_GUARD lock(m_mutex);
+            SetGridMemory(x, y, TERRAIN_SOURCE_MMAP, bytes);
+            sTerrainMgr.RegisterTileLoad(TERRAIN_SOURCE_MMAP, bytes, ElapsedMicroseconds(loadStart));
+        }
     }
 
     if (m_GridMaps[x][y])
@@ -1245,11 +1370,19 @@ float TerrainInfo::GetWaterLevel(float x, float y, float z, float* pGround /*= n
 //////////////////////////////////////////////////////////////////////////
 
 #define CLASS_LOCK MaNGOS::ClassLevelLockable<TerrainManager, std::mutex>
+#define TERRAIN_BUDGET_RETRY_INTERVAL 10000
 INSTANTIATE_SINGLETON_2(TerrainManager, CLASS_LOCK);
 INSTANTIATE_CLASS_MUTEX(TerrainManager, std::mutex);
 
-TerrainManager::TerrainManager()
+TerrainManager::TerrainManager() : m_stuckResidentBytes(0), m_budgetRetryTimer(0)
 {
+    for (int source = 0; source < MAX_TERRAIN_SOURCES; ++source)
+    {
+        m_residentBytes[source] = 0;
+        m_evictCount[source] = 0;
+        m_loadTimeUs[source] = 0;
+        m_loadCount[source] = 0;
+    }
 }
 
 TerrainManager::~TerrainManager()
@@ -1284,7 +1417,7 @@ void TerrainManager::UnloadTerrain(const uint32 mapId)
     {
         TerrainInfo* ptr = (*iter).second;
         // lets check if this object can be actually freed
-        if (!ptr->IsReferenced())
+        if (!ptr->IsReferenced() && !ptr->IsPinned())
         {
             i_TerrainMap.erase(iter);
             delete ptr;
@@ -1297,6 +1430,111 @@ void TerrainManager::Update(const uint32 diff)
     // global garbage collection for GridMap objects and VMaps
     for (auto& iter : i_TerrainMap)
         iter.second->CleanUpGrids(diff);
+
+    EnforceMemoryBudget(diff);
+}
+
+void TerrainManager::EnforceMemoryBudget(const uint32 diff)
+{
+    uint64 budget = GetMemoryBudget();
+    if (!budget)
+    {
+        m_stuckResidentBytes = 0;
+        return;
+    }
+
+    // pinned terrain is never evicted, so it doesn't count against the budget either
+    uint64 resident = GetResidentBytes();
+    for (auto& iter : i_TerrainMap)
+        if (iter.second->IsPinned())
+            resident -= std::min(iter.second->GetResidentBytes(), resident);
+
+    if (resident <= budget)
+    {
+        m_stuckResidentBytes = 0;
+        return;
+    }
+
+    // the tiles left are all referenced, don't sweep every grid each tick until more got loaded
+    // or some time passed for grids to get unreferenced
+    if (m_stuckResidentBytes)
+    {
+        if (resident <= m_stuckResidentBytes && m_budgetRetryTimer > diff)
+        {
+            m_budgetRetryTimer -= diff;
+            return;
+        }
+        m_stuckResidentBytes = 0;
+    }
+
+    uint64 bytesToFree = resident - budget;
+    uint64 bytesOverBudget = bytesToFree;
+
+    // first sweep gives recently accessed tiles a second chance, the next one evicts them as well
+    for (int sweep = 0; sweep < 2 && bytesToFree; ++sweep)
+    {
+        for (auto& iter : i_TerrainMap)
+        {
+            if (!bytesToFree)
+                break;
+
+            if (iter.second->IsPinned())
+                continue;
+
+            uint64 freed = iter.second->EvictGrids(bytesToFree, sweep == 0);
+            bytesToFree -= std::min(freed, bytesToFree);
+        }
+    }
+
+    if (bytesToFree == bytesOverBudget)
+    {
+        m_stuckResidentBytes = resident;
+        m_budgetRetryTimer = TERRAIN_BUDGET_RETRY_INTERVAL;
+    }
+}
+
+void TerrainManager::RegisterTileLoad(TerrainTileSource source, uint32 bytes, uint64 loadTimeUs)
+{
+    m_residentBytes[source] += bytes;
+    m_loadTimeUs[source] += loadTimeUs;
+    ++m_loadCount[source];
+}
+
+void TerrainManager::RegisterTileUnload(TerrainTileSource source, uint32 bytes)
+{
+    m_residentBytes[source] -= bytes;
+}
+
+uint64 TerrainManager::GetResidentBytes() const
+{
+    uint64 total = 0;
+    for (const auto& bytes : m_residentBytes)
+        total += bytes;
+    return total;
+}
+
+uint64 TerrainManager::GetMemoryBudget() const
+{
+    return uint64(sWorld.getConfig(CONFIG_UINT32_TERRAIN_MEMORY_BUDGET)) * 1024 * 1024;
+}
+
+void TerrainManager::GenerateMetrics()
+{
+    static char const* sourceNames[MAX_TERRAIN_SOURCES] = { "map", "vmap", "mmap" };
+
+    metric::measurement meas("world.metrics.terrain");
+    for (int source = 0; source < MAX_TERRAIN_SOURCES; ++source)
+    {
+        uint32 loads = m_loadCount[source].exchange(0);
+        uint64 loadTime = m_loadTimeUs[source].exchange(0);
+
+        meas.add_field(std::string(sourceNames[source]) + "_bytes", std::to_string(m_residentBytes[source]));
+        meas.add_field(std::string(sourceNames[source]) + "_loads", std::to_string(loads));
+        meas.add_field(std::string(sourceNames[source]) + "_load_us", std::to_string(loads ? loadTime / loads : 0));
+        meas.add_field(std::string(sourceNames[source]) + "_evictions", std::to_string(m_evictCount[source].exchange(0)));
+    }
+    meas.add_field("total_bytes", std::to_string(GetResidentBytes()));
+    meas.add_field("budget_bytes", std::to_string(GetMemoryBudget()));
 }
 
 void TerrainManager::UnloadAll()
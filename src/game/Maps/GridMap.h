@@ -79,6 +79,9 @@ class GridMap
         // For fast check
         bool m_fullyLoaded;
 
+        // heap memory held by the loaded data arrays
+        uint32 m_memoryUsage;
+
         bool loadAreaData(FILE* in, uint32 offset, uint32 size);
         bool loadHeightData(FILE* in, uint32 offset, uint32 size);
         bool loadGridMapLiquidData(FILE* in, uint32 offset, uint32 size);
@@ -102,6 +105,7 @@ class GridMap
         void unloadData();
         bool IsFullyLoaded() const { return m_fullyLoaded; }
         void SetFullyLoaded() { m_fullyLoaded = true; }
+        uint32 GetMemoryUsage() const { return sizeof(GridMap) + m_memoryUsage; }
 
         static bool ExistMap(uint32 mapid, int gx, int gy);
         static bool ExistVMap(uint32 mapid, int gx, int gy);
@@ -131,6 +135,15 @@ class Referencable
         Countable m_count;
 };
 
+// geometry sources sharing a terrain tile (grid) lifetime
+enum TerrainTileSource
+{
+    TERRAIN_SOURCE_MAP  = 0,
+    TERRAIN_SOURCE_VMAP = 1,
+    TERRAIN_SOURCE_MMAP = 2,
+    MAX_TERRAIN_SOURCES
+};
+
 // class for sharing and managin GridMap objects
 class TerrainInfo : public Referencable<std::atomic_long>
 {
@@ -168,6 +181,17 @@ class TerrainInfo : public Referencable<std::atomic_long>
         // THIS METHOD IS NOT THREAD-SAFE!!!! AND IT SHOULDN'T BE THREAD-SAFE!!!!
         void CleanUpGrids(const uint32 diff);
 
+        // unload unreferenced tiles in CLOCK order until bytesToFree is reached, returns freed bytes
+        // recently accessed tiles get a second chance unless secondChance is false
+        // THIS METHOD IS NOT THREAD-SAFE!!!! same rules as CleanUpGrids
+        uint64 EvictGrids(uint64 bytesToFree, bool secondChance);
+
+        // pinned terrain keeps its tiles resident once loaded
+        bool IsPinned() const;
+
+        // bytes of all loaded tiles of this terrain
+        uint64 GetResidentBytes() const { return m_residentBytes; }
+
     protected:
         friend class Map;
         friend class ObjectMgr;
@@ -185,11 +209,22 @@ class TerrainInfo : public Referencable<std::atomic_long>
         int RefGrid(const uint32& x, const uint32& y);
         int UnrefGrid(const uint32& x, const uint32& y);
 
+        // evicted tiles are counted per source in the terrain metrics
+        uint64 UnloadGrid(const uint32 x, const uint32 y, bool evicted = false);
+        void SetGridMemory(const uint32 x, const uint32 y, TerrainTileSource source, uint32 bytes);
+
         const uint32 m_mapId;
 
         GridMap* m_GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         int16 m_GridRef[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
 
+        // resident bytes per tile and source, protected by m_mutex
+        uint32 m_GridMemory[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS][MAX_TERRAIN_SOURCES];
+        std::atomic<uint64> m_residentBytes;
+        // CLOCK reference bit, set on every geometry access
+        std::atomic<bool> m_GridAccessed[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        uint32 m_clockHand;
+
         // global garbage collection timer
         ShortIntervalTimer i_timer;
 
@@ -212,6 +247,16 @@ class TerrainManager : public MaNGOS::Singleton<TerrainManager, MaNGOS::ClassLev
         void Update(const uint32 diff);
         void UnloadAll();
 
+        // tile cache accounting, thread safe
+        void RegisterTileLoad(TerrainTileSource source, uint32 bytes, uint64 loadTimeUs);
+        void RegisterTileUnload(TerrainTileSource source, uint32 bytes);
+        void RegisterTileEviction(TerrainTileSource source) { ++m_evictCount[source]; }
+        uint64 GetResidentBytes(TerrainTileSource source) const { return m_residentBytes[source]; }
+        uint64 GetResidentBytes() const;
+        uint64 GetMemoryBudget() const;
+
+        void GenerateMetrics();
+
         uint16 GetAreaFlag(uint32 mapid, float x, float y, float z) const
         {
             TerrainInfo* pData = const_cast<TerrainManager*>(this)->LoadTerrain(mapid);
@@ -243,6 +288,17 @@ class TerrainManager : public MaNGOS::Singleton<TerrainManager, MaNGOS::ClassLev
 
         typedef MaNGOS::ClassLevelLockable<TerrainManager, std::mutex>::Lock Guard;
         TerrainDataMap i_TerrainMap;
+
+        void EnforceMemoryBudget(const uint32 diff);
+
+        std::atomic<uint64> m_residentBytes[MAX_TERRAIN_SOURCES];
+        std::atomic<uint64> m_loadTimeUs[MAX_TERRAIN_SOURCES];
+        std::atomic<uint32> m_loadCount[MAX_TERRAIN_SOURCES];
+        std::atomic<uint32> m_evictCount[MAX_TERRAIN_SOURCES];
+
+        // resident bytes left over budget by a sweep that could not free anything, 0 if none
+        uint64 m_stuckResidentBytes;
+        uint32 m_budgetRetryTimer;
 };
 
 #define sTerrainMgr TerrainManager::Instance()
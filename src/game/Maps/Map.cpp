@@ -594,6 +594,9 @@ void Map::Update(const uint32& t_diff)
 
     uint64 count = 0;
 
+    // temporaries of the last tick are gone
+    m_tickArena.Reset();
+
     m_dyn_tree.update(t_diff);
 
     GetMessager().Execute(this);
@@ -601,7 +604,7 @@ void Map::Update(const uint32& t_diff)
     /// update active cells around players and active objects
     resetMarkedCells();
 
-    WorldObjectUnSet objToUpdate;
+    WorldObjectUnSet objToUpdate(&m_tickArena);
     MaNGOS::ObjectUpdater obj_updater(objToUpdate, t_diff);
     TypeContainerVisitor<MaNGOS::ObjectUpdater, GridTypeMapContainer  > grid_object_update(obj_updater);    // For creature
     TypeContainerVisitor<MaNGOS::ObjectUpdater, WorldTypeMapContainer > world_object_update(obj_updater);   // For pets
@@ -704,6 +707,10 @@ void Map::Update(const uint32& t_diff)
     // Send world objects and item update field changes
     SendObjectUpdates();
 
+    meas.add_field("arena_used", std::to_string(m_tickArena.GetUsed()));
+    meas.add_field("arena_high_water", std::to_string(m_tickArena.GetHighWater()));
+    meas.add_field("arena_buffer", std::to_string(m_tickArena.GetBufferSize()));
+
     // Don't unload grids if it's battleground, since we may have manually added GOs,creatures, those doesn't load from DB at grid re-load !
     // This isn't really bother us, since as soon as we have instanced BG-s, the whole map unloads as the BG gets ended
     if (!IsBattleGroundOrArena())
@@ -2027,7 +2034,7 @@ WorldObject* Map::GetWorldObject(ObjectGuid guid)
 
 void Map::SendObjectUpdates()
 {
-    UpdateDataMapType update_players;
+    UpdateDataMapType update_players(&m_tickArena);
 
     while (!i_objectsToClientUpdate.empty())
     {
@@ -2036,6 +2043,27 @@ void Map::SendObjectUpdates()
         obj->BuildUpdateData(update_players);
     }
 
+    // with helper threads all packets get built and compressed first, then are sent in the same order
+    UpdatePacketWorkers& packetWorkers = sMapMgr.GetUpdatePacketWorkers();
+    if (packetWorkers.Activated() && update_players.size() > 1)
+    {
+        std::vector<UpdatePacketJob> jobs;
+        jobs.reserve(update_players.size());
+        for (auto& update_player : update_players)
+            jobs.emplace_back(&update_player.second);
+
+        packetWorkers.BuildPackets(jobs);
+
+        auto job = jobs.begin();
+        for (auto& update_player : update_players)
+        {
+            for (WorldPacket const& packet : job->packets)
+                update_player.first->GetSession()->SendPacket(packet);
+            ++job;
+        }
+        return;
+    }
+
     for (auto& update_player : update_players)
     {
         for (size_t i = 0; i < update_player.second.GetPacketCount(); ++i)
@@ -35,6 +35,7 @@
 #include "Entities/CreatureLinkingMgr.h"
 #include "vmap/DynamicTree.h"
 #include "Multithreading/Messager.h"
+#include "Maps/TickArena.h"
 
 #include <bitset>
 #include <functional>
@@ -374,6 +375,8 @@ class Map : public GridRefManager<NGridType>
         void SendObjectUpdates();
         std::set<Object*> i_objectsToClientUpdate;
 
+        TickArena m_tickArena;                              // tick scoped containers of Update, reset at the start of each Update
+
     protected:
         MapEntry const* i_mapEntry;
         uint8 i_spawnMode;
@@ -59,6 +59,9 @@ void MapManager::Initialize()
     int num_threads(sWorld.getConfig(CONFIG_UINT32_NUM_MAP_THREADS));
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    if (uint32 packetThreads = sWorld.getConfig(CONFIG_UINT32_NUM_UPDATE_PACKET_THREADS))
+        m_updatePacketWorkers.Activate(packetThreads);
 }
 
 void MapManager::InitStateMachine()
@@ -267,6 +270,9 @@ void MapManager::UnloadAll()
     if (m_updater.activated())
         m_updater.deactivate();
 
+    if (m_updatePacketWorkers.Activated())
+        m_updatePacketWorkers.Deactivate();
+
     TerrainManager::Instance().UnloadAll();
 }
 
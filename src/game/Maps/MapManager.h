@@ -26,6 +26,7 @@
 #include "Maps/Map.h"
 #include "Grids/GridStates.h"
 #include "Maps/MapUpdater.h"
+#include "Maps/UpdatePacketWorkers.h"
 
 #include <functional>
 
@@ -94,6 +95,8 @@ class MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::ClassLevelLockab
 
         void UnloadAll();
 
+        UpdatePacketWorkers& GetUpdatePacketWorkers() { return m_updatePacketWorkers; }
+
         static bool ExistMapAndVMap(uint32 mapid, float x, float y);
         static bool IsValidMAP(uint32 mapid);
 
@@ -185,6 +188,7 @@ class MapManager : public MaNGOS::Singleton<MapManager, MaNGOS::ClassLevelLockab
 
         uint32 i_MaxInstanceId;
         MapUpdater m_updater;
+        UpdatePacketWorkers m_updatePacketWorkers;
 };
 
 template<typename Do>
@@ -0,0 +1,53 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Maps/TickArena.h"
+
+TickArena::TickArena(size_t bufferSize) : m_bufferSize(bufferSize), m_used(0), m_highWater(0)
+{
+    m_buffer.reset(new unsigned char[m_bufferSize]);
+    m_resource.reset(new std::pmr::monotonic_buffer_resource(m_buffer.get(), m_bufferSize));
+}
+
+void TickArena::Reset()
+{
+    m_highWater = std::max(m_highWater, m_used);
+
+    if (m_used > m_bufferSize && m_bufferSize < MAX_BUFFER_SIZE)
+    {
+        // last tick did not fit, grow the buffer so the next ones do
+        size_t newSize = m_bufferSize;
+        while (newSize < m_used && newSize < MAX_BUFFER_SIZE)
+            newSize *= 2;
+
+        m_resource.reset();
+        m_bufferSize = std::min(newSize, MAX_BUFFER_SIZE);
+        m_buffer.reset(new unsigned char[m_bufferSize]);
+        m_resource.reset(new std::pmr::monotonic_buffer_resource(m_buffer.get(), m_bufferSize));
+    }
+    else
+        m_resource->release();
+
+    m_used = 0;
+}
+
+void* TickArena::do_allocate(size_t bytes, size_t alignment)
+{
+    m_used += bytes;
+    return m_resource->allocate(bytes, alignment);
+}
@@ -0,0 +1,59 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_TICKARENA_H
+#define MANGOS_TICKARENA_H
+
+#include "Platform/Define.h"
+
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+
+// Monotonic memory resource for containers that only live during one map tick.
+// Deallocation is a no-op, all memory is dropped at once by Reset(). The owned buffer grows
+// to the largest tick seen (up to MAX_BUFFER_SIZE), bigger ticks get extra chunks from the heap.
+// Not thread safe, only to be used from the thread updating the owning map.
+class TickArena : public std::pmr::memory_resource
+{
+    public:
+        explicit TickArena(size_t bufferSize = MIN_BUFFER_SIZE);
+
+        // all containers using the arena must be destroyed before
+        void Reset();
+
+        size_t GetUsed() const { return m_used; }           // bytes handed out since last Reset
+        size_t GetHighWater() const { return std::max(m_highWater, m_used); } // most bytes handed out within one tick
+        size_t GetBufferSize() const { return m_bufferSize; }
+
+    private:
+        static constexpr size_t MIN_BUFFER_SIZE = 16 * 1024;
+        static constexpr size_t MAX_BUFFER_SIZE = 1024 * 1024;
+
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* /*ptr*/, size_t /*bytes*/, size_t /*alignment*/) override {}
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override { return this == &other; }
+
+        std::unique_ptr<unsigned char[]> m_buffer;
+        size_t m_bufferSize;
+        std::unique_ptr<std::pmr::monotonic_buffer_resource> m_resource;
+        size_t m_used;
+        size_t m_highWater;
+};
+
+#endif
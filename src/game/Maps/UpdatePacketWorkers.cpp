@@ -0,0 +1,98 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Maps/UpdatePacketWorkers.h"
+#include "Entities/UpdateData.h"
+
+#include <algorithm>
+
+void UpdatePacketWorkers::Activate(size_t numThreads)
+{
+    if (Activated())
+        return;
+
+    m_cancelationToken = false;
+    for (size_t i = 0; i < numThreads; ++i)
+        m_workerThreads.push_back(std::thread(&UpdatePacketWorkers::WorkerThread, this));
+}
+
+void UpdatePacketWorkers::Deactivate()
+{
+    m_cancelationToken = true;
+
+    m_queue.Cancel();
+
+    for (auto& thread : m_workerThreads)
+        thread.join();
+
+    m_workerThreads.clear();
+}
+
+void UpdatePacketWorkers::BuildPackets(std::vector<UpdatePacketJob>& jobs)
+{
+    if (jobs.empty())
+        return;
+
+    std::shared_ptr<Batch> batch = std::make_shared<Batch>(jobs);
+
+    // no more helpers than jobs left once the calling thread took its first one
+    size_t helpers = std::min(m_workerThreads.size(), jobs.size() - 1);
+    for (size_t i = 0; i < helpers; ++i)
+        m_queue.Push(std::shared_ptr<Batch>(batch));
+
+    batch->Run();
+
+    std::unique_lock<std::mutex> lock(batch->lock);
+    while (batch->done < batch->count)
+        batch->condition.wait(lock);
+}
+
+void UpdatePacketWorkers::Batch::Run()
+{
+    size_t built = 0;
+    for (size_t i = next++; i < count; i = next++)
+    {
+        UpdatePacketJob& job = jobs[i];
+        job.packets.reserve(job.data->GetPacketCount());
+        for (size_t p = 0; p < job.data->GetPacketCount(); ++p)
+            job.packets.push_back(job.data->BuildPacket(p));
+        ++built;
+    }
+
+    if (built && done.fetch_add(built) + built == count)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        condition.notify_all();
+    }
+}
+
+void UpdatePacketWorkers::WorkerThread()
+{
+    while (true)
+    {
+        std::shared_ptr<Batch> batch;
+
+        m_queue.WaitAndPop(batch);
+
+        if (m_cancelationToken)
+            return;
+
+        if (batch)
+            batch->Run();
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef _UPDATE_PACKET_WORKERS_H_INCLUDED
+#define _UPDATE_PACKET_WORKERS_H_INCLUDED
+
+#include "Platform/Define.h"
+#include "ProducerConsumerQueue.h"
+#include "WorldPacket.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class UpdateData;
+
+// Packets of one update data, built by whichever thread takes the job
+struct UpdatePacketJob
+{
+    explicit UpdatePacketJob(UpdateData* data) : data(data) {}
+
+    UpdateData* data;
+    std::vector<WorldPacket> packets;
+};
+
+// Threads that build and compress update packets for the maps. A map hands over the update data of all its
+// players at once and helps building them itself, then sends the packets in order once all are done.
+class UpdatePacketWorkers
+{
+    public:
+        UpdatePacketWorkers() : m_cancelationToken(false) {}
+        UpdatePacketWorkers(const UpdatePacketWorkers&) = delete;
+
+        void Activate(size_t numThreads);
+        void Deactivate();
+        bool Activated() const { return !m_workerThreads.empty(); }
+
+        // returns when the packets of all jobs are built
+        void BuildPackets(std::vector<UpdatePacketJob>& jobs);
+
+    private:
+        struct Batch
+        {
+            explicit Batch(std::vector<UpdatePacketJob>& jobs) : jobs(jobs), count(jobs.size()), next(0), done(0) {}
+
+            void Run();
+
+            std::vector<UpdatePacketJob>& jobs;             // only touched while jobs are left, the owner waits for them
+            size_t const count;
+            std::atomic<size_t> next;
+            std::atomic<size_t> done;
+
+            std::mutex lock;
+            std::condition_variable condition;
+        };
+
+        ProducerConsumerQueue<std::shared_ptr<Batch>> m_queue;
+        std::vector<std::thread> m_workerThreads;
+        std::atomic<bool> m_cancelationToken;
+
+        void WorkerThread();
+};
+
+#endif
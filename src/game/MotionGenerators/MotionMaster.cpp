@@ -562,6 +562,8 @@ void MotionMaster::MoveFall()
 
 void MotionMaster::Mutate(MovementGenerator* m)
 {
+    m_owner->WakeUp();
+
     if (!empty())
     {
         switch (top()->GetMovementGeneratorType())
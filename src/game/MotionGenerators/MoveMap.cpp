@@ -194,6 +194,20 @@ namespace MMAP
         return false;
     }
 
+    uint32 MMapManager::GetTileMemoryUsage(uint32 mapId, uint32 x, uint32 y) const
+    {
+        auto itr = loadedMMaps.find(mapId);
+        if (itr == loadedMMaps.end())
+            return 0;
+
+        auto tileItr = itr->second->mmapLoadedTiles.find(packTileID(x, y));
+        if (tileItr == itr->second->mmapLoadedTiles.end())
+            return 0;
+
+        dtMeshTile const* tile = itr->second->navMesh->getTileByRef(tileItr->second);
+        return tile ? uint32(tile->dataSize) : 0;
+    }
+
     bool MMapManager::loadMap(uint32 mapId, int32 x, int32 y)
     {
         // make sure the mmap is loaded and ready to load tiles
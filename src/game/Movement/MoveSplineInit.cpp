@@ -28,6 +28,8 @@ namespace Movement
 
     int32 MoveSplineInit::Launch()
     {
+        unit.WakeUp();
+
         MoveSpline& move_spline = *unit.movespline;
         TransportInfo* transportInfo = unit.GetTransportInfo();
 
@@ -24,6 +24,7 @@
 #include "Globals/Locales.h"
 #include "Globals/SharedDefines.h"
 #include "Server/SQLStorages.h"
+#include "Timer.h"
 
 #include "DBCfmt.h"
 
@@ -201,6 +202,15 @@ static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string&
     return false;
 }
 
+struct DBCLoadStatistics
+{
+    uint32 inPlaceStores;
+    size_t mappedBytes;
+    size_t heapBytes;
+};
+
+static DBCLoadStatistics dbcLoadStatistics;
+
 template<class T>
 inline void LoadDBC(uint32& availableDbcLocales, BarGoLink& bar, StoreProblemList& errlist, DBCStorage<T>& storage, const std::string& dbc_path, const std::string& filename)
 {
@@ -220,6 +230,11 @@ inline void LoadDBC(uint32& availableDbcLocales, BarGoLink& bar, StoreProblemLis
             if (!storage.LoadStringsFrom(dbc_filename_loc.c_str()))
                 availableDbcLocales &= ~(1 << i);           // mark as not available for speedup next checks
         }
+
+        if (storage.IsDataInPlace())
+            ++dbcLoadStatistics.inPlaceStores;
+        dbcLoadStatistics.mappedBytes += storage.GetMappedBytes();
+        dbcLoadStatistics.heapBytes += storage.GetHeapBytes();
     }
     else
     {
@@ -240,6 +255,8 @@ inline void LoadDBC(uint32& availableDbcLocales, BarGoLink& bar, StoreProblemLis
 void LoadDBCStores(const std::string& dataPath)
 {
     std::string dbcPath = dataPath + "dbc/";
+    uint32 oldMSTime = WorldTimer::getMSTime();
+    dbcLoadStatistics = DBCLoadStatistics();
 
     const uint32 DBCFilesCount = 66;
 
@@ -582,7 +599,9 @@ void LoadDBCStores(const std::string& dataPath)
         exit(1);
     }
 
-    sLog.outString(">> Initialized %d data stores", DBCFilesCount);
+    sLog.outString(">> Initialized %d data stores in %u ms", DBCFilesCount, WorldTimer::getMSTimeDiff(oldMSTime, WorldTimer::getMSTime()));
+    sLog.outString(">> %u stores used in place, " SIZEFMTD " KB served from mapped files, " SIZEFMTD " KB copied to heap",
+                   dbcLoadStatistics.inPlaceStores, dbcLoadStatistics.mappedBytes / 1024, dbcLoadStatistics.heapBytes / 1024);
     sLog.outString();
 }
 
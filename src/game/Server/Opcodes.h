@@ -1117,6 +1117,7 @@ enum PacketProcessing
     PROCESS_THREADSAFE,                                     // packet is thread-safe - process it in Map::Update()
     PROCESS_MAP_THREAD,                                     // packet is map thread safe
     PROCESS_IMMEDIATE,                                      // packet is network thread safe
+    PROCESS_SESSION_THREAD,                                 // packet only touches own session/player and static data - may be processed concurrently with other sessions in World::UpdateSessions()
 };
 
 class WorldPacket;
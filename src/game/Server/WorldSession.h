@@ -282,6 +282,7 @@ class WorldSession
         void DeleteMovementPackets();
 
         bool Update(uint32 diff);
+        void UpdateParallel();
         void UpdateMap(uint32 diff);
 
         /// Handle the authentication waiting queue (to be completed)
@@ -859,6 +860,7 @@ class WorldSession
         void HandleMoverRelocation(const MovementInfoPtr& movementInfo);
 
         void ExecuteOpcode(OpcodeHandler const& opHandle, WorldPacket& packet);
+        void ProcessPacket(WorldPacket& packet);
 
         // logging helper
         void LogUnexpectedOpcode(WorldPacket const& packet, const char* reason) const;
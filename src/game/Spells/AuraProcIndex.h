@@ -0,0 +1,79 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_AURAPROCINDEX_H
+#define MANGOS_AURAPROCINDEX_H
+
+#include "Common.h"
+
+#include <algorithm>
+#include <vector>
+
+// Aura holders of a unit that can proc, ordered by spell id like Unit::m_spellAuraHolders so procs are
+// handled in unchanged order, with the union of their proc flags to reject events no holder reacts to.
+// Holder needs GetId() and GetProcFlags(), the latter 0 for holders that can't proc.
+template <class Holder>
+class AuraProcIndex
+{
+    public:
+        typedef std::vector<Holder*> HolderVector;
+        typedef typename HolderVector::const_iterator const_iterator;
+
+        AuraProcIndex() : m_procFlagMask(0) {}
+
+        void Add(Holder* holder)
+        {
+            if (!holder->GetProcFlags())
+                return;
+
+            // new holder after others of same spell id, like in the holder multimap
+            auto itr = std::upper_bound(m_holders.begin(), m_holders.end(), holder->GetId(),
+                [](uint32 spellId, Holder const* other) { return spellId < other->GetId(); });
+            m_holders.insert(itr, holder);
+            m_procFlagMask |= holder->GetProcFlags();
+        }
+
+        void Remove(Holder* holder)
+        {
+            if (!holder->GetProcFlags())
+                return;
+
+            auto itr = std::find(m_holders.begin(), m_holders.end(), holder);
+            if (itr == m_holders.end())
+                return;
+
+            m_holders.erase(itr);
+
+            m_procFlagMask = 0;
+            for (Holder* procHolder : m_holders)
+                m_procFlagMask |= procHolder->GetProcFlags();
+        }
+
+        // false if no holder reacts to any of the event flags
+        bool CanProc(uint32 procFlags) const { return (m_procFlagMask & procFlags) != 0; }
+        uint32 GetProcFlagMask() const { return m_procFlagMask; }
+
+        const_iterator begin() const { return m_holders.begin(); }
+        const_iterator end() const { return m_holders.end(); }
+
+    private:
+        HolderVector m_holders;
+        uint32 m_procFlagMask;                              // union of proc flags of m_holders
+};
+
+#endif
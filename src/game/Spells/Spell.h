@@ -28,6 +28,7 @@
 #include "Entities/Player.h"
 #include "Server/SQLStorages.h"
 #include "Spells/SpellEffectDefines.h"
+#include "Utilities/ObjectPool.h"
 
 class WorldSession;
 class WorldPacket;
@@ -275,7 +276,7 @@ class SpellLog
         uint32 m_currentEffect;
 };
 
-class Spell
+class Spell : public MaNGOS::PooledObject<Spell>
 {
         friend struct MaNGOS::SpellNotifierPlayer;
         friend struct MaNGOS::SpellNotifierCreatureAndPlayer;
@@ -22,6 +22,7 @@
 #include "Server/DBCEnums.h"
 #include "Entities/ObjectGuid.h"
 #include "Spells/Scripts/SpellScript.h"
+#include "Utilities/ObjectPool.h"
 
 /**
  * Used to modify what an Aura does to a player/npc.
@@ -90,7 +91,28 @@ enum SpellAuraHolderState
     SPELLAURAHOLDER_STATE_DB_LOAD       = 3                 // during db load some events must not be executed
 };
 
-class SpellAuraHolder
+enum SpellProcDescriptorFlags
+{
+    PROC_DESC_HAS_EVENT             = 0x01,                 // spell_proc_event entry exists (ppm, chance, cooldown, family masks)
+    PROC_DESC_ALWAYS                = 0x02,                 // kill/killed/trap/death flags, trigger without further checks
+    PROC_DESC_DONE_HOT_NEED_FAMILY  = 0x04,                 // only done periodic flag, HOT must have spell family
+    PROC_DESC_DONE_HOT_DENY         = 0x08,                 // no done positive flags, can't proc from done HOT
+    PROC_DESC_DONE_DOT_DENY         = 0x10,                 // no done negative flags, can't proc from done DOT
+    PROC_DESC_TAKEN_HOT_DENY        = 0x20,                 // no taken positive flags, can't proc from taken HOT
+    PROC_DESC_TAKEN_DOT_DENY        = 0x40,                 // no taken negative flags, can't proc from taken DOT
+};
+
+// Proc requirements of a spell compiled by SpellMgr from dbc and spell_proc_event data, see SpellMgr::IsSpellProcDescriptorTriggeredBy
+struct SpellProcDescriptor
+{
+    uint32 procFlags;                                       // event proc flags, 0 if spell can't proc
+    uint32 procEx;                                          // extra requirements (PROC_EX_NONE without spell_proc_event)
+    uint32 schoolMask;                                      // required school of proc spell, 0 for any
+    uint32 spellFamilyName;                                 // required family of proc spell, 0 for any
+    uint32 flags;                                           // SpellProcDescriptorFlags
+};
+
+class SpellAuraHolder : public MaNGOS::PooledObject<SpellAuraHolder>
 {
     public:
         SpellAuraHolder(SpellEntry const* spellproto, Unit* target, WorldObject* caster, Item* castItem, SpellEntry const* triggeredBy);
@@ -163,6 +185,8 @@ class SpellAuraHolder
         uint8 GetAuraLevel() const { return m_auraLevel; }
         void SetAuraLevel(uint8 level) { m_auraLevel = level; }
         uint32 GetAuraCharges() const { return m_procCharges; }
+        uint32 GetProcFlags() const { return m_procDescriptor.procFlags; }
+        SpellProcDescriptor const& GetProcDescriptor() const { return m_procDescriptor; }
         void SetAuraCharges(uint32 charges, bool update = true);
 
         bool DropAuraCharge();                               // return true if last charge dropped
@@ -216,6 +240,7 @@ class SpellAuraHolder
         uint8 m_auraSlot;                                   // Aura slot on unit (for show in client)
         uint8 m_auraLevel;                                  // Aura level (store caster level for correct show level dep amount)
         uint32 m_procCharges;                               // Aura charges (0 for infinite)
+        SpellProcDescriptor m_procDescriptor;               // Proc requirements copied from SpellMgr at creation
         uint32 m_stackAmount;                               // Aura stack amount
         int32 m_maxDuration;                                // Max aura duration
         int32 m_duration;                                   // Current time
@@ -254,7 +279,7 @@ typedef void(Aura::*pAuraHandler)(bool Apply, bool Real);
 //      each setting object update field code line moved under if(Real) check is significant mangos speedup, and less server->client data sends
 //      each packet sending code moved under if(Real) check is _large_ mangos speedup, and lot less server->client data sends
 
-class Aura
+class Aura : public MaNGOS::PooledObject<Aura>
 {
         friend struct ReapplyAffectedPassiveAurasHelper;
         friend Aura* CreateAura(SpellEntry const* spellproto, SpellEffectIndex eff, int32 const* currentDamage, int32 const* currentBasePoints, SpellAuraHolder* holder, Unit* target, Unit* caster, Item* castItem);
@@ -0,0 +1,115 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MANGOS_SPELLIDTABLE_H
+#define MANGOS_SPELLIDTABLE_H
+
+#include "Common.h"
+
+#include <algorithm>
+#include <vector>
+
+// Copy of a side table keyed by spell id, laid out by id after loading so that a lookup on the spell paths
+// is a bounds check and an indexed load. The maps stay the storage used while loading.
+template <class T>
+class SpellIdTable
+{
+    public:
+        template <class Map, class KeyToIndex>
+        void Build(Map const& map, KeyToIndex keyToIndex)
+        {
+            Clear();
+
+            uint32 size = 0;
+            for (auto const& itr : map)
+                size = std::max(size, keyToIndex(itr.first) + 1);
+
+            m_index.assign(size, 0);
+            m_values.reserve(map.size());
+            for (auto const& itr : map)
+            {
+                m_values.push_back(itr.second);
+                m_index[keyToIndex(itr.first)] = m_values.size();
+            }
+        }
+
+        template <class Map>
+        void Build(Map const& map) { Build(map, [](uint32 key) { return key; }); }
+
+        void Clear()
+        {
+            m_index.clear();
+            m_values.clear();
+        }
+
+        T const* Find(uint32 index) const
+        {
+            if (index >= m_index.size() || !m_index[index])
+                return nullptr;
+
+            return &m_values[m_index[index] - 1];
+        }
+
+    private:
+        std::vector<uint32> m_index;                        // position in m_values + 1, 0 for ids without entry
+        std::vector<T> m_values;
+};
+
+// Same for tables with several values per spell id, the values of an id are contiguous
+template <class T>
+class SpellIdRangeTable
+{
+    public:
+        typedef std::pair<uint32, T> value_type;
+        typedef std::pair<value_type const*, value_type const*> Bounds;
+
+        template <class MultiMap>
+        void Build(MultiMap const& map)
+        {
+            Clear();
+            if (map.empty())
+                return;
+
+            m_values.assign(map.begin(), map.end());        // ordered by id
+            m_offsets.assign(map.rbegin()->first + 2, 0);
+            for (value_type const& value : m_values)
+                ++m_offsets[value.first + 1];
+            for (size_t i = 1; i < m_offsets.size(); ++i)
+                m_offsets[i] += m_offsets[i - 1];
+        }
+
+        void Clear()
+        {
+            m_offsets.clear();
+            m_values.clear();
+        }
+
+        Bounds Find(uint32 id) const
+        {
+            if (id + 1 >= m_offsets.size())
+                return Bounds(nullptr, nullptr);
+
+            return Bounds(m_values.data() + m_offsets[id], m_values.data() + m_offsets[id + 1]);
+        }
+
+    private:
+        std::vector<uint32> m_offsets;                      // values of id are m_offsets[id] .. m_offsets[id + 1]
+        std::vector<value_type> m_values;
+};
+
+#endif
@@ -26,6 +26,7 @@
 #include "Spells/Spell.h"
 #include "Entities/Unit.h"
 #include "World/World.h"
+#include "Metric/Metric.h"
 
 bool IsPrimaryProfessionSkill(uint32 skill)
 {
@@ -39,7 +40,7 @@ bool IsPrimaryProfessionSkill(uint32 skill)
     return true;
 }
 
-SpellMgr::SpellMgr()
+SpellMgr::SpellMgr() : m_procEvaluated(0), m_procTriggered(0)
 {
 }
 
@@ -815,6 +816,7 @@ void SpellMgr::LoadSpellProcEvents()
         bar.step();
         sLog.outString();
         sLog.outString(">> No spell proc event conditions loaded");
+        LoadSpellProcDescriptors();
         return;
     }
 
@@ -853,6 +855,62 @@ void SpellMgr::LoadSpellProcEvents()
 
     sLog.outString(">> Loaded %u extra spell proc event conditions +%u custom proc (inc. +%u custom ranks)",  rankHelper.worker.count, rankHelper.worker.customProc, rankHelper.customRank);
     sLog.outString();
+
+    LoadSpellProcDescriptors();
+}
+
+void SpellMgr::LoadSpellProcDescriptors()
+{
+    mSpellProcDescriptorMap.clear();                        // need for reload case
+
+    for (uint32 spell = 0; spell < sSpellTemplate.GetMaxEntry(); ++spell)
+    {
+        SpellEntry const* entry = sSpellTemplate.LookupEntry<SpellEntry>(spell);
+        if (!entry)
+            continue;
+
+        SpellProcEventEntry const* spellProcEvent = GetSpellProcEvent(spell);
+
+        // same rule as at proc time: custom procFlags override dbc ones
+        uint32 eventProcFlag = spellProcEvent && spellProcEvent->procFlags ? spellProcEvent->procFlags : entry->procFlags;
+        if (!eventProcFlag)
+            continue;
+
+        SpellProcDescriptor& procDescriptor = mSpellProcDescriptorMap[spell];
+        procDescriptor.procFlags = eventProcFlag;
+        procDescriptor.procEx = spellProcEvent ? spellProcEvent->procEx : uint32(PROC_EX_NONE);
+        procDescriptor.schoolMask = spellProcEvent ? spellProcEvent->schoolMask : 0;
+        procDescriptor.spellFamilyName = spellProcEvent ? spellProcEvent->spellFamilyName : 0;
+        procDescriptor.flags = spellProcEvent ? PROC_DESC_HAS_EVENT : 0;
+
+        if (eventProcFlag & (PROC_FLAG_KILLED | PROC_FLAG_KILL | PROC_FLAG_ON_TRAP_ACTIVATION | PROC_FLAG_DEATH))
+            procDescriptor.flags |= PROC_DESC_ALWAYS;
+
+        if (eventProcFlag == PROC_FLAG_ON_DO_PERIODIC)
+            procDescriptor.flags |= PROC_DESC_DONE_HOT_NEED_FAMILY;
+        else
+        {
+            if (!(eventProcFlag & (PROC_FLAG_DONE_SPELL_MAGIC_DMG_CLASS_POS | PROC_FLAG_DONE_SPELL_NONE_DMG_CLASS_POS)))
+                procDescriptor.flags |= PROC_DESC_DONE_HOT_DENY;
+            if (!(eventProcFlag & (PROC_FLAG_DONE_SPELL_MAGIC_DMG_CLASS_NEG | PROC_FLAG_DONE_SPELL_NONE_DMG_CLASS_NEG)))
+                procDescriptor.flags |= PROC_DESC_DONE_DOT_DENY;
+        }
+
+        if (eventProcFlag == PROC_FLAG_ON_TAKE_PERIODIC || !(eventProcFlag & (PROC_FLAG_TAKEN_SPELL_MAGIC_DMG_CLASS_POS | PROC_FLAG_TAKEN_SPELL_NONE_DMG_CLASS_POS)))
+            procDescriptor.flags |= PROC_DESC_TAKEN_HOT_DENY;
+        if (eventProcFlag != PROC_FLAG_ON_TAKE_PERIODIC && !(eventProcFlag & (PROC_FLAG_TAKEN_SPELL_MAGIC_DMG_CLASS_NEG | PROC_FLAG_TAKEN_SPELL_NONE_DMG_CLASS_NEG)))
+            procDescriptor.flags |= PROC_DESC_TAKEN_DOT_DENY;
+    }
+
+    sLog.outString(">> Compiled %u spell proc descriptors", uint32(mSpellProcDescriptorMap.size()));
+    sLog.outString();
+}
+
+void SpellMgr::GenerateMetrics()
+{
+    metric::measurement meas("world.metrics.procs");
+    meas.add_field("evaluated", std::to_string(m_procEvaluated.exchange(0)));
+    meas.add_field("triggered", std::to_string(m_procTriggered.exchange(0)));
 }
 
 struct DoSpellProcItemEnchant
@@ -867,6 +925,7 @@ struct DoSpellProcItemEnchant
 void SpellMgr::LoadSpellProcItemEnchant()
 {
     mSpellProcItemEnchantMap.clear();                       // need for reload case
+    mSpellProcItemEnchantTable.Clear();
 
     uint32 count = 0;
 
@@ -921,6 +980,8 @@ void SpellMgr::LoadSpellProcItemEnchant()
 
     delete result;
 
+    mSpellProcItemEnchantTable.Build(mSpellProcItemEnchantMap);
+
     sLog.outString(">> Loaded %u proc item enchant definitions", count);
     sLog.outString();
 }
@@ -1166,6 +1227,7 @@ bool SpellMgr::IsSpellProcEventCanTriggeredBy(SpellProcEventEntry const* spellPr
 void SpellMgr::LoadSpellElixirs()
 {
     mSpellElixirs.clear();                                  // need for reload case
+    mSpellElixirTable.Clear();
 
     uint32 count = 0;
 
@@ -1209,6 +1271,8 @@ void SpellMgr::LoadSpellElixirs()
 
     delete result;
 
+    mSpellElixirTable.Build(mSpellElixirs);
+
     sLog.outString(">> Loaded %u spell elixir definitions", count);
     sLog.outString();
 }
@@ -1281,6 +1345,7 @@ struct DoSpellThreat
 void SpellMgr::LoadSpellThreats()
 {
     mSpellThreatMap.clear();                                // need for reload case
+    mSpellThreatTable.Clear();
 
     //                                                0      1       2           3
     QueryResult* result = WorldDatabase.Query("SELECT entry, Threat, multiplier, ap_bonus FROM spell_threat");
@@ -1318,6 +1383,8 @@ void SpellMgr::LoadSpellThreats()
 
     delete result;
 
+    mSpellThreatTable.Build(mSpellThreatMap);
+
     sLog.outString(">> Loaded %u spell threat entries", rankHelper.worker.count);
     sLog.outString();
 }
@@ -1903,6 +1970,7 @@ void SpellMgr::LoadSpellLearnSkills()
 void SpellMgr::LoadSpellLearnSpells()
 {
     mSpellLearnSpells.clear();                              // need for reload case
+    mSpellLearnSpellTable.Clear();
 
     //                                                0      1        2
     QueryResult* result = WorldDatabase.Query("SELECT entry, SpellID, Active FROM spell_learn_spell");
@@ -1984,7 +2052,7 @@ void SpellMgr::LoadSpellLearnSpells()
                 // other required explicit dependent learning
                 dbc_node.autoLearned = entry->EffectImplicitTargetA[i] == TARGET_UNIT_CASTER_PET || GetTalentSpellCost(spell) > 0 || IsPassiveSpell(entry) || IsSpellHaveEffect(entry, SPELL_EFFECT_SKILL_STEP);
 
-                SpellLearnSpellMapBounds db_node_bounds = GetSpellLearnSpellMapBounds(spell);
+                auto db_node_bounds = mSpellLearnSpells.equal_range(spell);
 
                 bool found = false;
                 for (SpellLearnSpellMap::const_iterator itr = db_node_bounds.first; itr != db_node_bounds.second; ++itr)
@@ -2007,6 +2075,8 @@ void SpellMgr::LoadSpellLearnSpells()
         }
     }
 
+    mSpellLearnSpellTable.Build(mSpellLearnSpells);
+
     sLog.outString(">> Loaded %u spell learn spells + %u found in DBC", count, dbc_count);
     sLog.outString();
 }
@@ -2295,6 +2365,7 @@ bool SpellMgr::IsSpellValid(SpellEntry const* spellInfo, Player* pl, bool msg)
 void SpellMgr::LoadSpellAreas()
 {
     mSpellAreaMap.clear();                                  // need for reload case
+    mSpellAreaTable.Clear();
     mSpellAreaForAuraMap.clear();
 
     uint32 count = 0;
@@ -2340,7 +2411,7 @@ void SpellMgr::LoadSpellAreas()
 
         {
             bool ok = true;
-            SpellAreaMapBounds sa_bounds = GetSpellAreaMapBounds(spellArea.spellId);
+            auto sa_bounds = mSpellAreaMap.equal_range(spellArea.spellId);
             for (SpellAreaMap::const_iterator itr = sa_bounds.first; itr != sa_bounds.second; ++itr)
             {
                 if (spellArea.spellId != itr->second.spellId)
@@ -2468,7 +2539,7 @@ void SpellMgr::LoadSpellAreas()
                     continue;
                 }
 
-                SpellAreaMapBounds saBound2 = GetSpellAreaMapBounds(spellArea.auraSpell);
+                auto saBound2 = mSpellAreaMap.equal_range(spellArea.auraSpell);
                 for (SpellAreaMap::const_iterator itr2 = saBound2.first; itr2 != saBound2.second; ++itr2)
                 {
                     if (itr2->second.autocast && itr2->second.auraSpell > 0)
@@ -2502,6 +2573,8 @@ void SpellMgr::LoadSpellAreas()
 
     delete result;
 
+    mSpellAreaTable.Build(mSpellAreaMap);
+
     sLog.outString(">> Loaded %u spell area requirements", count);
     sLog.outString();
 }
@@ -2533,7 +2606,7 @@ SpellCastResult SpellMgr::GetSpellAllowedInLocationError(SpellEntry const* spell
     SpellAreaMapBounds saBounds = GetSpellAreaMapBounds(spellInfo->Id);
     if (saBounds.first != saBounds.second)
     {
-        for (SpellAreaMap::const_iterator itr = saBounds.first; itr != saBounds.second; ++itr)
+        for (auto itr = saBounds.first; itr != saBounds.second; ++itr)
         {
             if (itr->second.IsFitToRequirements(player, zone_id, area_id))
                 return SPELL_CAST_OK;
@@ -3191,6 +3264,7 @@ struct DoSpellAffectMasks
 void SpellMgr::LoadSpellAffects()
 {
     mSpellAffectMap.clear();                                // need for reload case
+    mSpellAffectTable.Clear();
 
     uint32 count = 0;
 
@@ -3276,6 +3350,8 @@ void SpellMgr::LoadSpellAffects()
 
     delete result;
 
+    mSpellAffectTable.Build(mSpellAffectMap, [](uint32 key) { return (key >> 8) * MAX_EFFECT_INDEX + (key & 0xFF); });
+
     sLog.outString();
     sLog.outString(">> Loaded %u spell affect definitions", count);
 
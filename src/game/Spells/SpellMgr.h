@@ -36,8 +36,10 @@
 #include "Spells/SpellAuras.h"
 #include "Server/SQLStorages.h"
 #include "Spells/SpellEffectDefines.h"
+#include "Spells/SpellIdTable.h"
 
 #include <map>
+#include <atomic>
 
 class Player;
 class Spell;
@@ -2192,6 +2194,7 @@ struct SpellBonusEntry
 };
 
 typedef std::unordered_map<uint32, SpellProcEventEntry> SpellProcEventMap;
+typedef std::unordered_map<uint32, SpellProcDescriptor> SpellProcDescriptorMap;
 typedef std::unordered_map<uint32, SpellBonusEntry>     SpellBonusMap;
 
 #define ELIXIR_BATTLE_MASK    0x01
@@ -2322,7 +2325,7 @@ struct SpellArea
 typedef std::multimap<uint32 /*applySpellId*/, SpellArea> SpellAreaMap;
 typedef std::multimap<uint32 /*auraSpellId*/, SpellArea const*> SpellAreaForAuraMap;
 typedef std::multimap<uint32 /*areaOrZoneId*/, SpellArea const*> SpellAreaForAreaMap;
-typedef std::pair<SpellAreaMap::const_iterator, SpellAreaMap::const_iterator> SpellAreaMapBounds;
+typedef SpellIdRangeTable<SpellArea>::Bounds SpellAreaMapBounds;
 typedef std::pair<SpellAreaForAuraMap::const_iterator, SpellAreaForAuraMap::const_iterator>  SpellAreaForAuraMapBounds;
 typedef std::pair<SpellAreaForAreaMap::const_iterator, SpellAreaForAreaMap::const_iterator>  SpellAreaForAreaMapBounds;
 
@@ -2357,7 +2360,7 @@ struct SpellLearnSpellNode
 };
 
 typedef std::multimap<uint32, SpellLearnSpellNode> SpellLearnSpellMap;
-typedef std::pair<SpellLearnSpellMap::const_iterator, SpellLearnSpellMap::const_iterator> SpellLearnSpellMapBounds;
+typedef SpellIdRangeTable<SpellLearnSpellNode>::Bounds SpellLearnSpellMapBounds;
 
 typedef std::multimap<uint32, SkillLineAbilityEntry const*> SkillLineAbilityMap;
 typedef std::pair<SkillLineAbilityMap::const_iterator, SkillLineAbilityMap::const_iterator> SkillLineAbilityMapBounds;
@@ -2393,9 +2396,8 @@ class SpellMgr
         // Spell affects
         ClassFamilyMask GetSpellAffectMask(uint32 spellId, SpellEffectIndex effectId) const
         {
-            SpellAffectMap::const_iterator itr = mSpellAffectMap.find((spellId << 8) + effectId);
-            if (itr != mSpellAffectMap.end())
-                return ClassFamilyMask(itr->second);
+            if (uint64 const* mask = mSpellAffectTable.Find(spellId * MAX_EFFECT_INDEX + effectId))
+                return ClassFamilyMask(*mask);
             if (SpellEntry const* spellEntry = sSpellTemplate.LookupEntry<SpellEntry>(spellId))
                 return ClassFamilyMask(spellEntry->EffectItemType[effectId]);
             return ClassFamilyMask();
@@ -2405,11 +2407,10 @@ class SpellMgr
 
         uint32 GetSpellElixirMask(uint32 spellid) const
         {
-            SpellElixirMap::const_iterator itr = mSpellElixirs.find(spellid);
-            if (itr == mSpellElixirs.end())
-                return 0x0;
+            if (uint8 const* mask = mSpellElixirTable.Find(spellid))
+                return *mask;
 
-            return itr->second;
+            return 0x0;
         }
 
         SpellSpecific GetSpellElixirSpecific(uint32 spellid) const
@@ -2611,11 +2612,7 @@ class SpellMgr
 
         SpellThreatEntry const* GetSpellThreatEntry(uint32 spellid) const
         {
-            SpellThreatMap::const_iterator itr = mSpellThreatMap.find(spellid);
-            if (itr != mSpellThreatMap.end())
-                return &itr->second;
-
-            return nullptr;
+            return mSpellThreatTable.Find(spellid);
         }
 
         float GetSpellThreatMultiplier(SpellEntry const* spellInfo) const
@@ -2641,15 +2638,71 @@ class SpellMgr
         // Spell procs from item enchants
         float GetItemEnchantProcChance(uint32 spellid) const
         {
-            SpellProcItemEnchantMap::const_iterator itr = mSpellProcItemEnchantMap.find(spellid);
-            if (itr == mSpellProcItemEnchantMap.end())
-                return 0.0f;
+            if (float const* ppmRate = mSpellProcItemEnchantTable.Find(spellid))
+                return *ppmRate;
 
-            return itr->second;
+            return 0.0f;
         }
 
         static bool IsSpellProcEventCanTriggeredBy(SpellProcEventEntry const* spellProcEvent, uint32 EventProcFlag, SpellEntry const* procSpell, uint32 procFlags, uint32 procExtra);
 
+        // Compiled proc requirements, only for spells able to proc
+        SpellProcDescriptor const* GetSpellProcDescriptor(uint32 spellId) const
+        {
+            SpellProcDescriptorMap::const_iterator itr = mSpellProcDescriptorMap.find(spellId);
+            if (itr != mSpellProcDescriptorMap.end())
+                return &itr->second;
+            return nullptr;
+        }
+
+        // Same result as IsSpellProcEventCanTriggeredBy, using requirements compiled at load
+        static bool IsSpellProcDescriptorTriggeredBy(SpellProcDescriptor const& procDescriptor, SpellEntry const* procSpell, uint32 procFlags, uint32 procExtra)
+        {
+            uint32 matchedFlags = procFlags & procDescriptor.procFlags;
+            if (!matchedFlags)
+                return false;
+
+            if (procDescriptor.flags & PROC_DESC_ALWAYS)
+                return true;
+
+            if (matchedFlags & PROC_FLAG_ON_DO_PERIODIC)
+            {
+                if (procExtra & PROC_EX_INTERNAL_HOT)
+                {
+                    if (procDescriptor.flags & PROC_DESC_DONE_HOT_DENY)
+                        return false;
+                    if ((procDescriptor.flags & PROC_DESC_DONE_HOT_NEED_FAMILY) && !procSpell->SpellFamilyName)
+                        return false;
+                }
+                else if (procDescriptor.flags & PROC_DESC_DONE_DOT_DENY)
+                    return false;
+            }
+
+            if (matchedFlags & PROC_FLAG_ON_TAKE_PERIODIC)
+                if (procDescriptor.flags & ((procExtra & PROC_EX_INTERNAL_HOT) ? PROC_DESC_TAKEN_HOT_DENY : PROC_DESC_TAKEN_DOT_DENY))
+                    return false;
+
+            if (procDescriptor.schoolMask && (procDescriptor.schoolMask & (procSpell ? procSpell->SchoolMask : uint32(SPELL_SCHOOL_MASK_NORMAL))) == 0)
+                return false;
+
+            if (procSpell && procDescriptor.spellFamilyName && procDescriptor.spellFamilyName != procSpell->SpellFamilyName)
+                return false;
+
+            // No extra req, so can trigger for (damage/healing present) and hit/crit
+            if (procDescriptor.procEx == PROC_EX_NONE)
+                return (procExtra & (PROC_EX_NORMAL_HIT | PROC_EX_CRITICAL_HIT)) != 0;
+
+            return (procDescriptor.procEx & (PROC_EX_EX_TRIGGER_ALWAYS | procExtra)) != 0;
+        }
+
+        // Proc evaluation statistics, filled from Unit::ProcDamageAndSpellFor
+        void AddProcStatistics(uint32 evaluated, uint32 triggered)
+        {
+            m_procEvaluated += evaluated;
+            m_procTriggered += triggered;
+        }
+        void GenerateMetrics();
+
         // Spell bonus data
         SpellBonusEntry const* GetSpellBonusData(uint32 spellId) const
         {
@@ -2868,18 +2921,19 @@ class SpellMgr
 
         bool IsSpellLearnSpell(uint32 spell_id) const
         {
-            return mSpellLearnSpells.find(spell_id) != mSpellLearnSpells.end();
+            SpellLearnSpellMapBounds bounds = GetSpellLearnSpellMapBounds(spell_id);
+            return bounds.first != bounds.second;
         }
 
         SpellLearnSpellMapBounds GetSpellLearnSpellMapBounds(uint32 spell_id) const
         {
-            return mSpellLearnSpells.equal_range(spell_id);
+            return mSpellLearnSpellTable.Find(spell_id);
         }
 
         bool IsSpellLearnToSpell(uint32 parent, uint32 child) const
         {
             SpellLearnSpellMapBounds bounds = GetSpellLearnSpellMapBounds(parent);
-            for (SpellLearnSpellMap::const_iterator i = bounds.first; i != bounds.second; ++i)
+            for (auto i = bounds.first; i != bounds.second; ++i)
                 if (i->second.spell == child)
                     return true;
             return false;
@@ -2923,7 +2977,7 @@ class SpellMgr
 
         SpellAreaMapBounds GetSpellAreaMapBounds(uint32 spell_id) const
         {
-            return mSpellAreaMap.equal_range(spell_id);
+            return mSpellAreaTable.Find(spell_id);
         }
 
         SpellAreaForAuraMapBounds GetSpellAreaForAuraMapBounds(uint32 spell_id) const
@@ -2950,6 +3004,7 @@ class SpellMgr
         void LoadSpellAffects();
         void LoadSpellElixirs();
         void LoadSpellProcEvents();
+        void LoadSpellProcDescriptors();
         void LoadSpellProcItemEnchant();
         void LoadSpellBonuses();
         void LoadSpellTargetPositions();
@@ -2964,18 +3019,27 @@ class SpellMgr
         SpellChainMapNext  mSpellChainsNext;
         SpellLearnSkillMap mSpellLearnSkills;
         SpellLearnSpellMap mSpellLearnSpells;
+        SpellIdRangeTable<SpellLearnSpellNode> mSpellLearnSpellTable;
         SpellTargetPositionMap mSpellTargetPositions;
         SpellAffectMap     mSpellAffectMap;
+        SpellIdTable<uint64> mSpellAffectTable;             // by spell id * MAX_EFFECT_INDEX + effect index
         SpellElixirMap     mSpellElixirs;
+        SpellIdTable<uint8> mSpellElixirTable;
         SpellThreatMap     mSpellThreatMap;
+        SpellIdTable<SpellThreatEntry> mSpellThreatTable;
         SpellProcEventMap  mSpellProcEventMap;
+        SpellProcDescriptorMap mSpellProcDescriptorMap;
+        std::atomic<uint64> m_procEvaluated;
+        std::atomic<uint64> m_procTriggered;
         SpellProcItemEnchantMap mSpellProcItemEnchantMap;
+        SpellIdTable<float> mSpellProcItemEnchantTable;
         SpellBonusMap      mSpellBonusMap;
         SkillLineAbilityMap mSkillLineAbilityMapBySpellId;
         SkillLineAbilityMap mSkillLineAbilityMapBySkillId;
         SkillRaceClassInfoMap mSkillRaceClassInfoMap;
         SpellPetAuraMap     mSpellPetAuraMap;
         SpellAreaMap         mSpellAreaMap;
+        SpellIdRangeTable<SpellArea> mSpellAreaTable;
         SpellAreaForAuraMap  mSpellAreaForAuraMap;
         SpellAreaForAreaMap  mSpellAreaForAreaMap;
 };
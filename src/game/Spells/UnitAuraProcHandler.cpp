@@ -484,23 +484,35 @@ ProcExecutionData::ProcExecutionData(ProcSystemArguments& data, bool isVictim) :
 
 void Unit::ProcDamageAndSpellFor(ProcSystemArguments& argData, bool isVictim)
 {
+    // no holder can react to any of the event flags
+    if (!m_procAuraHolders.CanProc(isVictim ? argData.procFlagsVictim : argData.procFlagsAttacker))
+        return;
+
     ProcExecutionData execData(argData, isVictim);
 
     ProcTriggeredList procTriggered;
+    uint32 evaluated = 0;
     // Fill procTriggered list
-    for (SpellAuraHolderMap::const_iterator itr = GetSpellAuraHolderMap().begin(); itr != GetSpellAuraHolderMap().end(); ++itr)
+    for (SpellAuraHolder* holder : m_procAuraHolders)
     {
+        if (!(holder->GetProcFlags() & execData.procFlags))
+            continue;
+
         // skip deleted auras (possible at recursive triggered call
-        if (itr->second->GetState() != SPELLAURAHOLDER_STATE_READY || itr->second->IsDeleted())
+        if (holder->GetState() != SPELLAURAHOLDER_STATE_READY || holder->IsDeleted())
             continue;
 
+        ++evaluated;
         SpellProcEventEntry const* spellProcEvent = nullptr;
-        if (!IsTriggeredAtSpellProcEvent(execData, itr->second, spellProcEvent))
+        if (!IsTriggeredAtSpellProcEvent(execData, holder, spellProcEvent))
             continue;
 
-        procTriggered.push_back(ProcTriggeredData(spellProcEvent, itr->second));
+        procTriggered.push_back(ProcTriggeredData(spellProcEvent, holder));
     }
 
+    if (evaluated)
+        sSpellMgr.AddProcStatistics(evaluated, procTriggered.size());
+
     // Nothing found
     if (procTriggered.empty())
         return;
@@ -581,23 +593,16 @@ void Unit::ProcDamageAndSpellFor(ProcSystemArguments& argData, bool isVictim)
 bool Unit::IsTriggeredAtSpellProcEvent(ProcExecutionData& data, SpellAuraHolder* holder, SpellProcEventEntry const*& spellProcEvent)
 {
     SpellEntry const* spellProto = holder->GetSpellProto();
+    SpellProcDescriptor const& procDescriptor = holder->GetProcDescriptor();
 
-    // Get proc Event Entry
-    spellProcEvent = sSpellMgr.GetSpellProcEvent(spellProto->Id);
-
-    // Get EventProcFlag
-    uint32 EventProcFlag;
-    if (spellProcEvent && spellProcEvent->procFlags) // if exist get custom spellProcEvent->procFlags
-        EventProcFlag = spellProcEvent->procFlags;
-    else
-        EventProcFlag = spellProto->procFlags;       // else get from spell proto
-    // Continue if no trigger exist
-    if (!EventProcFlag)
+    // Check compiled proc requirements (proc flags, periodic, school, family, procEx)
+    if (!SpellMgr::IsSpellProcDescriptorTriggeredBy(procDescriptor, data.procSpell, data.procFlags, data.procExtra))
         return false;
 
-    // Check spellProcEvent data requirements
-    if (!SpellMgr::IsSpellProcEventCanTriggeredBy(spellProcEvent, EventProcFlag, data.procSpell, data.procFlags, data.procExtra))
-        return false;
+    // Get proc Event Entry for chance, cooldown and family masks
+    spellProcEvent = (procDescriptor.flags & PROC_DESC_HAS_EVENT) ? sSpellMgr.GetSpellProcEvent(spellProto->Id) : nullptr;
+
+    uint32 EventProcFlag = procDescriptor.procFlags;
 
     // In most cases req get honor or XP from kill
     if (EventProcFlag & PROC_FLAG_KILL && GetTypeId() == TYPEID_PLAYER)
@@ -25,6 +25,10 @@
 #include "Config/Config.h"
 #include "Platform/Define.h"
 #include "SystemConfig.h"
+#include "revision_sql.h"
+#include "Entities/CharacterEnumCache.h"
+#include "Entities/PlayerSaveScheduler.h"
+#include "Entities/OldCharacterDeletion.h"
 #include "Log.h"
 #include "Server/Opcodes.h"
 #include "Server/WorldSession.h"
@@ -41,9 +45,11 @@
 #include "Chat/Chat.h"
 #include "Server/DBCStores.h"
 #include "Mails/MassMailMgr.h"
+#include "Mails/MailExpiryMgr.h"
 #include "Loot/LootMgr.h"
 #include "Entities/ItemEnchantmentMgr.h"
 #include "Maps/MapManager.h"
+#include "Maps/MapWorkers.h"
 #include "DBScripts/ScriptMgr.h"
 #include "AI/CreatureAIRegistry.h"
 #include "Policies/Singleton.h"
@@ -65,8 +71,11 @@
 #include "Weather/Weather.h"
 #include "World/WorldState.h"
 #include "Cinematics/CinematicMgr.h"
+#include "Spells/Spell.h"
+#include "Spells/SpellAuras.h"
 
 #include "Custom/Custom.h"
+#include "Custom/AntiCheat/AntiCheatRecorder.h"
 
 #ifdef BUILD_AHBOT
 #include "AuctionHouseBot/AuctionHouseBot.h"
@@ -108,6 +117,9 @@ World::World() : mail_timer(0), mail_timer_expires(0), m_NextDailyQuestReset(0),
     m_gameTime = time(nullptr);
     m_startTime = m_gameTime;
     m_maxActiveSessionCount = 0;
+    m_parallelSessionTime = 0;
+    m_housekeepingJobs = 0;
+    m_housekeepingTime = 0;
     m_maxQueuedSessionCount = 0;
 
     m_defaultDbcLocale = DEFAULT_LOCALE;
@@ -150,6 +162,8 @@ void World::CleanupsBeforeStop()
 {
     KickAll(true);                                   // save and kick all players
     UpdateSessions(1);                               // real players unload required UpdateSessions call
+    if (m_sessionUpdater.activated())
+        m_sessionUpdater.deactivate();
     sBattleGroundMgr.DeleteAllBattleGrounds();       // unload battleground templates before different singletons destroyed
     sMapMgr.UnloadAll();                             // unload all grids (including locked in memory)
 }
@@ -463,11 +477,30 @@ void World::LoadConfigSettings(bool reload)
             m_configForceLoadMapIds.insert(id);
     }
 
+    setConfig(CONFIG_UINT32_TERRAIN_MEMORY_BUDGET, "Terrain.MemoryBudget", 0);
+
+    std::string terrainPinnedMaps = sConfig.GetStringDefault("Terrain.PinnedMaps");
+    m_configTerrainPinnedMapIds.clear();
+    if (!terrainPinnedMaps.empty())
+    {
+        unsigned int pos = 0;
+        unsigned int id;
+        VMAP::VMapFactory::chompAndTrim(terrainPinnedMaps);
+        while (VMAP::VMapFactory::getNextId(terrainPinnedMaps, pos, id))
+            m_configTerrainPinnedMapIds.insert(id);
+    }
+
     setConfig(CONFIG_BOOL_AUTOLOAD_ACTIVE, "Autoload.Active", true);
 
     setConfig(CONFIG_UINT32_INTERVAL_SAVE, "PlayerSave.Interval", 15 * MINUTE * IN_MILLISECONDS);
     setConfigMinMax(CONFIG_UINT32_MIN_LEVEL_STAT_SAVE, "PlayerSave.Stats.MinLevel", 0, 0, MAX_LEVEL);
     setConfig(CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT, "PlayerSave.Stats.SaveOnlyOnLogout", true);
+    setConfig(CONFIG_BOOL_PLAYER_SAVE_SCHEDULER, "PlayerSave.Scheduler", false);
+    setConfigMin(CONFIG_UINT32_PLAYER_SAVE_SCHEDULER_BURST, "PlayerSave.Scheduler.Burst", 5, 1);
+    setConfig(CONFIG_UINT32_PLAYER_SAVE_SCHEDULER_DB_QUEUE, "PlayerSave.Scheduler.DBQueueLimit", 500);
+    setConfig(CONFIG_UINT32_CHARACTER_ENUM_CACHE_SIZE, "CharacterEnumCache.MaxAccounts", 0);
+    if (!getConfig(CONFIG_UINT32_CHARACTER_ENUM_CACHE_SIZE))
+        sCharacterEnumCache.InvalidateAll();
 
     setConfigMin(CONFIG_UINT32_INTERVAL_GRIDCLEAN, "GridCleanUpDelay", 5 * MINUTE * IN_MILLISECONDS, MIN_GRID_DELAY);
     if (reload)
@@ -579,6 +612,7 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_UINT32_MAIL_DELIVERY_DELAY, "MailDeliveryDelay", HOUR);
 
     setConfigMin(CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK, "MassMailer.SendPerTick", 10, 1);
+    setConfigMin(CONFIG_UINT32_MAIL_EXPIRY_BATCH_SIZE, "MailExpiry.BatchSize", 500, 1);
 
     setConfig(CONFIG_UINT32_UPTIME_UPDATE, "UpdateUptimeInterval", 10);
     if (reload)
@@ -588,6 +622,9 @@ void World::LoadConfigSettings(bool reload)
     }
 
     setConfig(CONFIG_UINT32_NUM_MAP_THREADS, "MapUpdate.Threads", 3);
+    setConfig(CONFIG_UINT32_NUM_SESSION_THREADS, "SessionUpdate.Threads", 0);
+    setConfig(CONFIG_UINT32_NUM_UPDATE_PACKET_THREADS, "UpdatePacket.Threads", 0);
+    setConfig(CONFIG_UINT32_HOUSEKEEPING_BUDGET, "HousekeepingBudget", 10);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_ORANGE, "SkillChance.Orange", 100);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_YELLOW, "SkillChance.Yellow", 75);
     setConfig(CONFIG_UINT32_SKILL_CHANCE_GREEN,  "SkillChance.Green",  25);
@@ -675,6 +712,7 @@ void World::LoadConfigSettings(bool reload)
     setConfig(CONFIG_FLOAT_THREAT_RADIUS, "ThreatRadius", 100.0f);
     setConfigMin(CONFIG_UINT32_CREATURE_RESPAWN_AGGRO_DELAY, "CreatureRespawnAggroDelay", 5000, 0);
     setConfig(CONFIG_UINT32_CREATURE_PICKPOCKET_RESTOCK_DELAY, "CreaturePickpocketRestockDelay", 600);
+    setConfig(CONFIG_UINT32_CREATURE_DORMANT_UPDATE_INTERVAL, "CreatureDormantUpdateInterval", 0);
 
     // always use declined names in the russian client
     if (getConfig(CONFIG_UINT32_REALM_ZONE) == REALM_ZONE_RUSSIAN)
@@ -826,6 +864,12 @@ void World::LoadConfigSettings(bool reload)
 
     setConfig(CONFIG_BOOL_ACCOUNT_DATA, "AccountData", false);
 
+    // snapshots depend on core build (script ids, loader conversions), db structure and content release
+    std::string snapshotDir = sConfig.GetStringDefault("WorldSnapshot.Directory");
+    SQLStorageBase::SetSnapshotSettings(snapshotDir, std::string(REVISION_ID) + "|" + REVISION_DB_MANGOS + "|" + m_DBVersion);
+    if (!snapshotDir.empty())
+        sLog.outString("WORLD: SQL storage snapshots enabled in %s", snapshotDir.c_str());
+
     sCustom.LoadConfig();
 
     sLog.outString();
@@ -1328,6 +1372,12 @@ void World::SetInitialWorldSettings()
     sMapMgr.Initialize();
     sLog.outString();
 
+    if (uint32 sessionThreads = getConfig(CONFIG_UINT32_NUM_SESSION_THREADS))
+    {
+        m_sessionShards.resize(sessionThreads);
+        m_sessionUpdater.activate(sessionThreads);
+    }
+
     ///- Initialize Battlegrounds
     sLog.outString("Starting BattleGround System");
     sBattleGroundMgr.CreateInitialBattleGrounds();
@@ -1493,11 +1543,12 @@ void World::Update(uint32 diff)
         if (++mail_timer > mail_timer_expires)
         {
             mail_timer = 0;
-            sObjectMgr.ReturnOrDeleteOldMails(true);
+            sMailExpiryMgr.Start();
+            m_housekeepingJobs |= HOUSEKEEPING_MAILS;
         }
 
         ///- Handle expired auctions
-        sAuctionMgr.Update();
+        m_housekeepingJobs |= HOUSEKEEPING_AUCTIONS;
     }
 
 #ifdef BUILD_AHBOT
@@ -1530,6 +1581,7 @@ void World::Update(uint32 diff)
     sBattleGroundMgr.Update(diff);
     sOutdoorPvPMgr.Update(diff);
     sWorldState.Update(diff);
+    sPlayerSaveScheduler.Update(diff);
     auto postSingletonTime = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
     ///- Update groups with offline leaders
     if (m_timers[WUPDATE_GROUPS].Passed())
@@ -1546,7 +1598,8 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_DELETECHARS].Passed())
     {
         m_timers[WUPDATE_DELETECHARS].Reset();
-        Player::DeleteOldCharacters();
+        if (getConfig(CONFIG_UINT32_CHARDELETE_KEEP_DAYS))
+            m_housekeepingJobs |= HOUSEKEEPING_OLD_CHARACTERS;
     }
 
     // execute callbacks from sql queries that were queued recently
@@ -1557,9 +1610,11 @@ void World::Update(uint32 diff)
     {
         m_timers[WUPDATE_CORPSES].Reset();
 
-        sObjectAccessor.RemoveOldCorpses();
+        m_housekeepingJobs |= HOUSEKEEPING_CORPSES;
     }
 
+    UpdateHousekeeping();
+
     ///- Process Game events when necessary
     if (m_timers[WUPDATE_EVENTS].Passed())
     {
@@ -1574,6 +1629,13 @@ void World::Update(uint32 diff)
         m_timers[WUPDATE_METRICS].Reset();
 
         GeneratePacketMetrics();
+        GeneratePoolMetrics();
+        sTerrainMgr.GenerateMetrics();
+        sSpellMgr.GenerateMetrics();
+        sCharacterEnumCache.GenerateMetrics();
+        sPlayerSaveScheduler.GenerateMetrics();
+        sMailExpiryMgr.GenerateMetrics();
+        sAntiCheatRecorder.GenerateMetrics();
     }
 
     /// </ul>
@@ -1600,6 +1662,9 @@ void World::Update(uint32 diff)
     metric::measurement meas("world.update");
     meas.add_field("total", std::to_string(total));
     meas.add_field("presession", std::to_string(presession));
+    meas.add_field("sessions_parallel", std::to_string(m_parallelSessionTime));
+    meas.add_field("housekeeping", std::to_string(m_housekeepingTime));
+    meas.add_field("housekeeping_pending", std::to_string(m_housekeepingJobs));
     meas.add_field("premap", std::to_string(premap));
     meas.add_field("map", std::to_string(map));
     meas.add_field("singletons", std::to_string(singletons));
@@ -2032,6 +2097,55 @@ void World::ShutdownCancel()
     DEBUG_LOG("Server %s cancelled.", (m_ShutdownMask & SHUTDOWN_MASK_RESTART ? "restart" : "shutdown"));
 }
 
+/// Runs started maintenance jobs until the housekeeping budget of this tick is spent, each job
+/// makes progress of at least one entry per tick. Unfinished jobs are resumed at next tick
+void World::UpdateHousekeeping()
+{
+    m_housekeepingTime = 0;
+    if (!m_housekeepingJobs)
+        return;
+
+    TimeBudget budget(getConfig(CONFIG_UINT32_HOUSEKEEPING_BUDGET));
+
+    // jobs are not skipped at exceeded budget, so a long job can't starve the ones behind it
+    if (m_housekeepingJobs & HOUSEKEEPING_AUCTIONS)
+        if (sAuctionMgr.Update(budget))
+            m_housekeepingJobs &= ~HOUSEKEEPING_AUCTIONS;
+
+    if (m_housekeepingJobs & HOUSEKEEPING_MAILS)
+        if (sMailExpiryMgr.Update(budget))
+            m_housekeepingJobs &= ~HOUSEKEEPING_MAILS;
+
+    if (m_housekeepingJobs & HOUSEKEEPING_CORPSES)
+        if (sObjectAccessor.RemoveOldCorpses(budget))
+            m_housekeepingJobs &= ~HOUSEKEEPING_CORPSES;
+
+    if (m_housekeepingJobs & HOUSEKEEPING_OLD_CHARACTERS)
+        if (sOldCharacterDeletion.Update(budget))
+            m_housekeepingJobs &= ~HOUSEKEEPING_OLD_CHARACTERS;
+
+    m_housekeepingTime = budget.GetElapsed();
+}
+
+class SessionUpdateWorker : public Worker
+{
+    public:
+        SessionUpdateWorker(std::vector<WorldSession*>& sessions, MapUpdater& updater) :
+            Worker(updater), m_sessions(sessions)
+        {}
+
+        void execute() override
+        {
+            for (WorldSession* session : m_sessions)
+                session->UpdateParallel();
+
+            GetWorker().update_finished();
+        }
+
+    private:
+        std::vector<WorldSession*>& m_sessions;
+};
+
 void World::UpdateSessions(uint32 diff)
 {
     ///- Add new sessions
@@ -2046,7 +2160,29 @@ void World::UpdateSessions(uint32 diff)
             AddSession_(session);
     }
 
-    ///- Then send an update signal to remaining ones
+    ///- Process packets not touching other sessions or the world concurrently, sharded over session update threads
+    m_parallelSessionTime = 0;
+    if (m_sessionUpdater.activated() && !m_sessions.empty())
+    {
+        auto parallelStartTime = std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now());
+
+        size_t index = 0;
+        for (auto& session : m_sessions)
+            m_sessionShards[index++ % m_sessionShards.size()].push_back(session.second);
+
+        for (auto& shard : m_sessionShards)
+            if (!shard.empty())
+                m_sessionUpdater.schedule_update(new SessionUpdateWorker(shard, m_sessionUpdater));
+
+        m_sessionUpdater.wait();
+
+        for (auto& shard : m_sessionShards)
+            shard.clear();
+
+        m_parallelSessionTime = (std::chrono::time_point_cast<std::chrono::milliseconds>(Clock::now()) - parallelStartTime).count();
+    }
+
+    ///- Then send an update signal to remaining ones, packets which need exclusive world access are handled here in receive order
     for (SessionMap::iterator itr = m_sessions.begin(); itr != m_sessions.end();)
     {
         ///- and remove not active sessions from the list
@@ -2582,6 +2718,24 @@ void World::IncrementOpcodeCounter(uint32 opcodeId)
     ++m_opcodeCounters[opcodeId];
 }
 
+template <class T>
+static void GeneratePoolMetric(char const* type)
+{
+    MaNGOS::ObjectPoolCounters& counters = T::GetPoolCounters();
+    metric::measurement meas("world.metrics.pools", { { "type", type } });
+    meas.add_field("allocated", std::to_string(counters.allocated.exchange(0)));
+    meas.add_field("reused", std::to_string(counters.reused.exchange(0)));
+    meas.add_field("fallback", std::to_string(counters.fallback.exchange(0)));
+}
+
+void World::GeneratePoolMetrics()
+{
+    GeneratePoolMetric<Spell>("spell");
+    GeneratePoolMetric<Aura>("aura");
+    GeneratePoolMetric<SpellAuraHolder>("aura_holder");
+    GeneratePoolMetric<WorldPacket>("packet");
+}
+
 void World::GeneratePacketMetrics()
 {
     for (uint32 i = 0; i < NUM_MSG_TYPES; ++i)
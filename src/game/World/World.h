@@ -29,6 +29,7 @@
 #include "Globals/SharedDefines.h"
 #include "Entities/Object.h"
 #include "Multithreading/Messager.h"
+#include "Maps/MapUpdater.h"
 
 #include <atomic>
 #include <set>
@@ -86,6 +87,15 @@ enum WorldTimers
     WUPDATE_COUNT       = 9
 };
 
+/// Resumable maintenance jobs run within the housekeeping budget of a world tick
+enum HousekeepingJobs
+{
+    HOUSEKEEPING_AUCTIONS       = 0x01,                     // expire auctions
+    HOUSEKEEPING_CORPSES        = 0x02,                     // convert expired corpses to bones
+    HOUSEKEEPING_MAILS          = 0x04,                     // return or delete expired mails
+    HOUSEKEEPING_OLD_CHARACTERS = 0x08,                     // completely delete characters deleted CharDelete.KeepDays before
+};
+
 /// Configuration elements
 enum eConfigUInt32Values
 {
@@ -140,6 +150,10 @@ enum eConfigUInt32Values
     CONFIG_UINT32_MASS_MAILER_SEND_PER_TICK,
     CONFIG_UINT32_UPTIME_UPDATE,
     CONFIG_UINT32_NUM_MAP_THREADS,
+    CONFIG_UINT32_NUM_SESSION_THREADS,
+    CONFIG_UINT32_NUM_UPDATE_PACKET_THREADS,
+    CONFIG_UINT32_HOUSEKEEPING_BUDGET,
+    CONFIG_UINT32_MAIL_EXPIRY_BATCH_SIZE,
     CONFIG_UINT32_AUCTION_DEPOSIT_MIN,
     CONFIG_UINT32_SKILL_CHANCE_ORANGE,
     CONFIG_UINT32_SKILL_CHANCE_YELLOW,
@@ -202,6 +216,11 @@ enum eConfigUInt32Values
     CONFIG_UINT32_AUTOBROADCAST_TIMER,
     CONFIG_UINT32_PVPREWARD_TYPE,
     CONFIG_UINT32_PVPREWARD_AMOUNT,
+    CONFIG_UINT32_TERRAIN_MEMORY_BUDGET,
+    CONFIG_UINT32_CHARACTER_ENUM_CACHE_SIZE,
+    CONFIG_UINT32_PLAYER_SAVE_SCHEDULER_BURST,
+    CONFIG_UINT32_PLAYER_SAVE_SCHEDULER_DB_QUEUE,
+    CONFIG_UINT32_CREATURE_DORMANT_UPDATE_INTERVAL,
     CONFIG_UINT32_VALUE_COUNT
 };
 
@@ -353,6 +372,7 @@ enum eConfigBoolValues
     CONFIG_BOOL_OUTDOORPVP_NA_ENABLED,
     CONFIG_BOOL_KICK_PLAYER_ON_BAD_PACKET,
     CONFIG_BOOL_STATS_SAVE_ONLY_ON_LOGOUT,
+    CONFIG_BOOL_PLAYER_SAVE_SCHEDULER,
     CONFIG_BOOL_CLEAN_CHARACTER_DB,
     CONFIG_BOOL_VMAP_INDOOR_CHECK,
     CONFIG_BOOL_PET_UNSUMMON_AT_MOUNT,
@@ -598,6 +618,7 @@ class World
 
         /// Get configuration about force-loaded maps
         bool isForceLoadMap(uint32 id) const { return m_configForceLoadMapIds.find(id) != m_configForceLoadMapIds.end(); }
+        bool isTerrainPinnedMap(uint32 id) const { return m_configTerrainPinnedMapIds.find(id) != m_configTerrainPinnedMapIds.end(); }
 
         /// Are we on a "Player versus Player" server?
         bool IsPvPRealm() const { return (getConfig(CONFIG_UINT32_GAME_TYPE) == REALM_TYPE_PVP || getConfig(CONFIG_UINT32_GAME_TYPE) == REALM_TYPE_RPPVP || getConfig(CONFIG_UINT32_GAME_TYPE) == REALM_TYPE_FFA_PVP); }
@@ -666,6 +687,7 @@ class World
         void IncrementOpcodeCounter(uint32 opcodeId); // thread safe due to atomics
     protected:
         void _UpdateGameTime();
+        void UpdateHousekeeping();
         // callback for UpdateRealmCharacters
         void _UpdateRealmCharCount(QueryResult* resultCharCount, uint32 accountId);
 
@@ -681,6 +703,7 @@ class World
         void ResetMonthlyQuests();
 
         void GeneratePacketMetrics(); // thread safe due to atomics
+        void GeneratePoolMetrics();
 
     private:
         void setConfig(eConfigUInt32Values index, char const* fieldname, uint32 defvalue);
@@ -714,6 +737,12 @@ class World
         typedef std::unordered_set<uint32> UniqueSessions;
         SessionMap m_sessions;
         UniqueSessions m_uniqueSessionCount;
+        MapUpdater m_sessionUpdater;                        // runs WorldSession::UpdateParallel() over session shards
+        std::vector<std::vector<WorldSession*>> m_sessionShards;
+        long long m_parallelSessionTime;                    // ms spent in parallel session phase of last update
+
+        uint32 m_housekeepingJobs;                          // HousekeepingJobs mask of started and not finished jobs
+        uint32 m_housekeepingTime;                          // ms spent in housekeeping jobs of last update
         uint32 m_maxActiveSessionCount;
         uint32 m_maxQueuedSessionCount;
 
@@ -762,6 +791,7 @@ class World
 
         // List of Maps that should be force-loaded on startup
         std::set<uint32> m_configForceLoadMapIds;
+        std::set<uint32> m_configTerrainPinnedMapIds;
 
         // Vector of quests that were chosen for given group
         std::vector<uint32> m_eventGroupChosen;
@@ -98,6 +98,10 @@ namespace VMAP
             unsigned int iCurrentUniqueNameId;
             MapData mapData;
             std::set<std::string> spawnedModelFiles;
+            uint32 iThreads;
+
+            // writes the vmtree and vmtile files of one map, collecting the models it spawns
+            bool convertMap(uint32 mapID, MapSpawns& spawns, std::set<std::string>& modelFiles);
 
         public:
             TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName);
@@ -110,6 +114,8 @@ namespace VMAP
             void exportGameobjectModels();
             bool convertRawFile(const std::string& pModelFilename);
             void setModelNameFilterMethod(bool (*pFilterMethod)(char* pName)) { iFilterMethod = pFilterMethod; }
+            // maps and models are converted on up to this many threads, output does not depend on it
+            void setThreadCount(uint32 threads) { iThreads = threads ? threads : 1; }
     };
 }                                                           // VMAP
 #endif                                                      /*_TILEASSEMBLER_H_*/
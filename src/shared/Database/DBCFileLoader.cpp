@@ -20,70 +20,120 @@
 #include <stdlib.h>
 #include <string.h>
 
-#include "DBCFileLoader.h"
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-DBCFileLoader::DBCFileLoader()
-{
-    data = nullptr;
-    fieldsOffset = nullptr;
-}
+#include "DBCFileLoader.h"
 
-bool DBCFileLoader::Load(const char* filename, const char* fmt)
+bool DBCFileData::Open(const char* filename)
 {
-    uint32 header;
-    delete[] data;
+    Close();
 
-    FILE* f = fopen(filename, "rb");
-    if (!f)
+#ifndef _WIN32
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
         return false;
 
-    if (fread(&header, 4, 1, f) != 1)                       // Number of records
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
     {
-        fclose(f);
-        return false;
+        void* mapping = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED)
+        {
+            close(fd);
+            m_data = static_cast<unsigned char*>(mapping);
+            m_size = st.st_size;
+            m_mapped = true;
+            return true;
+        }
     }
 
+    close(fd);
+#endif
 
-    EndianConvert(header);
+    // fallback to reading whole file into heap
+    FILE* f = fopen(filename, "rb");
+    if (!f)
+        return false;
 
-    if (header != 0x43424457)                               //'WDBC'
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size <= 0)
     {
         fclose(f);
         return false;
     }
 
-    if (fread(&recordCount, 4, 1, f) != 1)                  // Number of records
+    m_data = new unsigned char[size];
+    m_size = size;
+    if (fread(m_data, m_size, 1, f) != 1)
     {
         fclose(f);
+        Close();
         return false;
     }
 
-    EndianConvert(recordCount);
+    fclose(f);
+    return true;
+}
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                   // Number of fields
-    {
-        fclose(f);
-        return false;
-    }
+void DBCFileData::Close()
+{
+    if (!m_data)
+        return;
 
-    EndianConvert(fieldCount);
+#ifndef _WIN32
+    if (m_mapped)
+        munmap(m_data, m_size);
+    else
+#endif
+        delete[] m_data;
 
-    if (fread(&recordSize, 4, 1, f) != 1)                   // Size of a record
-    {
-        fclose(f);
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+}
+
+DBCFileLoader::DBCFileLoader()
+{
+    data = nullptr;
+    fieldsOffset = nullptr;
+    m_file = nullptr;
+}
+
+bool DBCFileLoader::Load(const char* filename, const char* fmt)
+{
+    const uint32 headerSize = 5 * 4;
+
+    delete m_file;
+    data = nullptr;
+
+    m_file = new DBCFileData();
+    if (!m_file->Open(filename) || m_file->GetSize() < headerSize)
         return false;
-    }
 
-    EndianConvert(recordSize);
+    uint32 header[5];
+    memcpy(header, m_file->GetData(), headerSize);
+    for (uint32& value : header)
+        EndianConvert(value);
 
-    if (fread(&stringSize, 4, 1, f) != 1)                   // String size
-    {
-        fclose(f);
+    if (header[0] != 0x43424457)                            //'WDBC'
         return false;
-    }
 
-    EndianConvert(stringSize);
+    recordCount = header[1];                                // Number of records
+    fieldCount = header[2];                                 // Number of fields
+    recordSize = header[3];                                 // Size of a record
+    stringSize = header[4];                                 // String size
+
+    if (m_file->GetSize() < headerSize + size_t(recordSize) * recordCount + stringSize)
+        return false;
 
+    delete[] fieldsOffset;
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
     for (uint32 i = 1; i < fieldCount; ++i)
@@ -95,22 +145,14 @@ bool DBCFileLoader::Load(const char* filename, const char* fmt)
             fieldsOffset[i] += 4;
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
+    data = m_file->GetData() + headerSize;
     stringTable = data + recordSize * recordCount;
-
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
     return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
+    delete m_file;
     delete[] fieldsOffset;
 }
 
@@ -120,6 +162,30 @@ DBCFileLoader::Record DBCFileLoader::getRecord(size_t id)
     return Record(*this, data + id * recordSize);
 }
 
+DBCFileData* DBCFileLoader::ReleaseFileData()
+{
+    DBCFileData* file = m_file;
+    m_file = nullptr;
+    return file;
+}
+
+bool DBCFileLoader::CanUseInPlace(const char* format) const
+{
+#if MANGOS_ENDIAN == MANGOS_BIGENDIAN
+    return false;
+#else
+    if (!IsMapped() || strlen(format) != fieldCount)
+        return false;
+
+    // only plain 4 byte fields have the same layout in file and in memory
+    for (uint32 x = 0; format[x]; ++x)
+        if (format[x] != FT_INT && format[x] != FT_FLOAT && format[x] != FT_IND)
+            return false;
+
+    return recordSize == GetFormatRecordSize(format);
+#endif
+}
+
 uint32 DBCFileLoader::GetFormatRecordSize(const char* format, int32* index_pos)
 {
     uint32 recordsize = 0;
@@ -178,7 +244,6 @@ char* DBCFileLoader::AutoProduceData(const char* format, uint32& records, char**
     this func will generate  entry[rows] data;
     */
 
-    typedef char* ptr;
     if (strlen(format) != fieldCount)
         return nullptr;
 
@@ -186,27 +251,7 @@ char* DBCFileLoader::AutoProduceData(const char* format, uint32& records, char**
     int32 i;
     uint32 recordsize = GetFormatRecordSize(format, &i);
 
-    if (i >= 0)
-    {
-        uint32 maxi = 0;
-        // find max index
-        for (uint32 y = 0; y < recordCount; ++y)
-        {
-            uint32 ind = getRecord(y).getUInt(i);
-            if (ind > maxi)
-                maxi = ind;
-        }
-
-        ++maxi;
-        records = maxi;
-        indexTable = new ptr[maxi];
-        memset(indexTable, 0, maxi * sizeof(ptr));
-    }
-    else
-    {
-        records = recordCount;
-        indexTable = new ptr[recordCount];
-    }
+    indexTable = AllocateIndexTable(i, records);
 
     char* dataTable = new char[recordCount * recordsize];
 
@@ -259,13 +304,70 @@ char* DBCFileLoader::AutoProduceData(const char* format, uint32& records, char**
     return dataTable;
 }
 
+char** DBCFileLoader::AllocateIndexTable(int32 indexPos, uint32& records)
+{
+    typedef char* ptr;
+    ptr* indexTable;
+
+    if (indexPos >= 0)
+    {
+        uint32 maxi = 0;
+        // find max index
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            uint32 ind = getRecord(y).getUInt(indexPos);
+            if (ind > maxi)
+                maxi = ind;
+        }
+
+        ++maxi;
+        records = maxi;
+        indexTable = new ptr[maxi];
+        memset(indexTable, 0, maxi * sizeof(ptr));
+    }
+    else
+    {
+        records = recordCount;
+        indexTable = new ptr[recordCount];
+    }
+
+    return indexTable;
+}
+
+char* DBCFileLoader::AutoProduceInPlaceData(const char* format, uint32& records, char**& indexTable)
+{
+    if (!CanUseInPlace(format))
+        return nullptr;
+
+    int32 i;
+    GetFormatRecordSize(format, &i);
+
+    indexTable = AllocateIndexTable(i, records);
+
+    for (uint32 y = 0; y < recordCount; ++y)
+    {
+        char* record = reinterpret_cast<char*>(data + y * recordSize);
+        if (i >= 0)
+            indexTable[getRecord(y).getUInt(i)] = record;
+        else
+            indexTable[y] = record;
+    }
+
+    return reinterpret_cast<char*>(data);
+}
+
 char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
 {
     if (strlen(format) != fieldCount)
         return nullptr;
 
-    char* stringPool = new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
+    // mapped string table can be referenced directly, otherwise copy it out of the temporary file buffer
+    char* stringPool = reinterpret_cast<char*>(stringTable);
+    if (!IsMapped())
+    {
+        stringPool = new char[stringSize];
+        memcpy(stringPool, stringTable, stringSize);
+    }
 
     uint32 offset = 0;
 
@@ -311,5 +413,5 @@ char* DBCFileLoader::AutoProduceStrings(const char* format, char* dataTable)
         }
     }
 
-    return stringPool;
+    return IsMapped() ? nullptr : stringPool;
 }
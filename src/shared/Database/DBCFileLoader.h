@@ -38,6 +38,30 @@ enum FieldFormat
     FT_64BITINT = 'L'                                       // uint64
 };
 
+// raw content of a whole dbc file, memory mapped where the platform supports it
+// mapping is private (copy-on-write), unmodified pages stay shared with the page cache
+class DBCFileData
+{
+    public:
+        DBCFileData() : m_data(nullptr), m_size(0), m_mapped(false) {}
+        ~DBCFileData() { Close(); }
+
+        bool Open(const char* filename);
+        void Close();
+
+        unsigned char* GetData() const { return m_data; }
+        size_t GetSize() const { return m_size; }
+        bool IsMapped() const { return m_mapped; }
+
+    private:
+        DBCFileData(const DBCFileData&);
+        DBCFileData& operator=(const DBCFileData&);
+
+        unsigned char* m_data;
+        size_t m_size;
+        bool m_mapped;
+};
+
 class DBCFileLoader
 {
     public:
@@ -91,12 +115,23 @@ class DBCFileLoader
 
         uint32 GetNumRows() const { return recordCount;}
         uint32 GetCols() const { return fieldCount; }
+        uint32 GetRecordSize() const { return recordSize; }
+        uint32 GetStringSize() const { return stringSize; }
         uint32 GetOffset(size_t id) const { return (fieldsOffset != nullptr && id < fieldCount) ? fieldsOffset[id] : 0; }
         bool IsLoaded() const { return data != nullptr; }
+        bool IsMapped() const { return m_file && m_file->IsMapped(); }
         char* AutoProduceData(const char* format, uint32& records, char**& indexTable);
+        // strings point directly into the mapped string table and nullptr is returned when the file is mapped,
+        // the file data then has to be kept alive through ReleaseFileData
         char* AutoProduceStrings(const char* format, char* dataTable);
+        // index records directly inside the mapped file, only valid for CanUseInPlace formats
+        char* AutoProduceInPlaceData(const char* format, uint32& records, char**& indexTable);
+        bool CanUseInPlace(const char* format) const;
+        // transfer ownership of the file content to the caller
+        DBCFileData* ReleaseFileData();
         static uint32 GetFormatRecordSize(const char* format, int32* index_pos = nullptr);
     private:
+        char** AllocateIndexTable(int32 indexPos, uint32& records);
 
         uint32 recordSize;
         uint32 recordCount;
@@ -105,5 +140,6 @@ class DBCFileLoader
         uint32* fieldsOffset;
         unsigned char* data;
         unsigned char* stringTable;
+        DBCFileData* m_file;
 };
 #endif
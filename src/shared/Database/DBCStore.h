@@ -21,18 +21,27 @@
 
 #include "DBCFileLoader.h"
 
+#include <cstring>
+#include <list>
+
 template<class T>
 class DBCStorage
 {
         typedef std::list<char*> StringPoolList;
+        typedef std::list<DBCFileData*> FileDataList;
     public:
-        explicit DBCStorage(const char* f) : nCount(0), fieldCount(0), fmt(f), indexTable(nullptr), m_dataTable(nullptr) { }
+        explicit DBCStorage(const char* f) : nCount(0), fieldCount(0), fmt(f), indexTable(nullptr), m_dataTable(nullptr),
+            m_dataInPlace(false), m_mappedBytes(0), m_heapBytes(0) { }
         ~DBCStorage() { Clear(); }
 
         T const* LookupEntry(uint32 id) const { return (id >= nCount) ? nullptr : indexTable[id]; }
         uint32  GetNumRows() const { return nCount; }
         char const* GetFormat() const { return fmt; }
         uint32 GetFieldCount() const { return fieldCount; }
+        bool IsDataInPlace() const { return m_dataInPlace; }
+        // records and strings served from mapped files vs. copied to heap
+        size_t GetMappedBytes() const { return m_mappedBytes; }
+        size_t GetHeapBytes() const { return m_heapBytes; }
 
         bool Load(char const* fn)
         {
@@ -43,14 +52,26 @@ class DBCStorage
 
             fieldCount = dbc.GetCols();
 
-            // load raw non-string data
-            m_dataTable = (T*)dbc.AutoProduceData(fmt, nCount, (char**&)indexTable);
-
-            // load strings from dbc data
-            m_stringPoolList.push_back(dbc.AutoProduceStrings(fmt, (char*)m_dataTable));
+            // fixed layout records are used directly from the mapped file, others are converted to heap
+            m_dataInPlace = dbc.CanUseInPlace(fmt) && sizeof(T) == dbc.GetRecordSize();
+            if (m_dataInPlace)
+            {
+                m_dataTable = (T*)dbc.AutoProduceInPlaceData(fmt, nCount, (char**&)indexTable);
+                m_mappedBytes += size_t(dbc.GetRecordSize()) * dbc.GetNumRows();
+            }
+            else
+            {
+                m_dataTable = (T*)dbc.AutoProduceData(fmt, nCount, (char**&)indexTable);
+                m_heapBytes += DBCFileLoader::GetFormatRecordSize(fmt) * dbc.GetNumRows();
+            }
 
             // error in dbc file at loading if nullptr
-            return indexTable != nullptr;
+            if (!indexTable)
+                return false;
+
+            // load strings from dbc data
+            ProduceStrings(dbc, m_dataInPlace);
+            return true;
         }
 
         bool LoadStringsFrom(char const* fn)
@@ -65,7 +86,7 @@ class DBCStorage
                 return false;
 
             // load strings from another locale dbc data
-            m_stringPoolList.push_back(dbc.AutoProduceStrings(fmt, (char*)m_dataTable));
+            ProduceStrings(dbc, false);
 
             return true;
         }
@@ -77,27 +98,59 @@ class DBCStorage
 
             delete[]((char*)indexTable);
             indexTable = nullptr;
-            delete[]((char*)m_dataTable);
+            if (!m_dataInPlace)
+                delete[]((char*)m_dataTable);
             m_dataTable = nullptr;
+            m_dataInPlace = false;
 
             while (!m_stringPoolList.empty())
             {
                 delete[] m_stringPoolList.front();
                 m_stringPoolList.pop_front();
             }
+
+            // must be last, in place data and strings point into these
+            while (!m_fileDataList.empty())
+            {
+                delete m_fileDataList.front();
+                m_fileDataList.pop_front();
+            }
             nCount = 0;
+            m_mappedBytes = 0;
+            m_heapBytes = 0;
         }
 
         void EraseEntry(uint32 id) { assert(id < nCount && "To be erased entry must be in bounds!") ; indexTable[id] = nullptr; }
         void InsertEntry(T* entry, uint32 id) { assert(id < nCount && "To be inserted entry must be in bounds!"); indexTable[id] = entry; }
 
     private:
+        void ProduceStrings(DBCFileLoader& dbc, bool keepFileData)
+        {
+            bool hasStrings = strchr(fmt, FT_STRING) != nullptr;
+
+            if (char* stringPool = dbc.AutoProduceStrings(fmt, (char*)m_dataTable))
+            {
+                m_stringPoolList.push_back(stringPool);
+                m_heapBytes += dbc.GetStringSize();
+            }
+            else if (dbc.IsMapped() && hasStrings)
+                m_mappedBytes += dbc.GetStringSize();
+
+            // keep mapped file alive for strings and in place records referencing it
+            if (dbc.IsMapped() && (keepFileData || hasStrings))
+                m_fileDataList.push_back(dbc.ReleaseFileData());
+        }
+
         uint32 nCount;
         uint32 fieldCount;
         char const* fmt;
         T** indexTable;
         T* m_dataTable;
         StringPoolList m_stringPoolList;
+        FileDataList m_fileDataList;
+        bool m_dataInPlace;
+        size_t m_mappedBytes;
+        size_t m_heapBytes;
 };
 
 #endif
@@ -141,6 +141,10 @@ bool Database::Initialize(const char* infoString, int nConns /*= 1*/)
 
     m_pResultQueue = new SqlResultQueue;
 
+    // independent holder queries are spread over the sync connections
+    if (m_nQueryConnPoolSize > 1)
+        m_holderPool = new SqlHolderPool(m_pQueryConnections);
+
     InitDelayThread();
     return true;
 }
@@ -149,6 +153,10 @@ void Database::StopServer()
 {
     HaltDelayThread();
 
+    // after delay thread, it may still hand over holders while flushing
+    delete m_holderPool;
+    m_holderPool = nullptr;
+
     delete m_pResultQueue;
     delete m_pAsyncConn;
 
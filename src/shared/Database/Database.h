@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "Threading.h"
 #include "Database/SqlDelayThread.h"
+#include "Database/SqlHolderPool.h"
 #include "Policies/ThreadingModel.h"
 #include "SqlPreparedStatement.h"
 
@@ -212,6 +213,9 @@ class Database
         bool CheckRequiredField(char const* table_name, char const* required_name);
         uint32 GetPingIntervall() const { return m_pingIntervallms; }
 
+        // amount of async requests not yet executed by the delay thread
+        size_t GetDelayQueueSize() const { return m_threadBody ? m_threadBody->GetQueueSize() : 0; }
+
         // function to ping database connections
         void Ping();
 
@@ -223,7 +227,7 @@ class Database
     protected:
         Database() :
             m_nQueryConnPoolSize(1), m_pAsyncConn(nullptr), m_pResultQueue(nullptr),
-            m_threadBody(nullptr), m_delayThread(nullptr), m_allowAsyncTransactions(false),
+            m_threadBody(nullptr), m_delayThread(nullptr), m_holderPool(nullptr), m_allowAsyncTransactions(false),
             m_iStmtIndex(-1), m_logSQL(false), m_pingIntervallms(0)
         {
             m_nQueryCounter = -1;
@@ -266,6 +270,7 @@ class Database
         SqlResultQueue*     m_pResultQueue;                 ///< Transaction queues from diff. threads
         SqlDelayThread*     m_threadBody;                   ///< Pointer to delay sql executer (owned by m_delayThread)
         MaNGOS::Thread*     m_delayThread;                  ///< Pointer to executer thread
+        SqlHolderPool*      m_holderPool;                   ///< Parallel query holder execution, only with more than one query connection
 
         std::atomic<bool> m_allowAsyncTransactions;         ///< flag which specifies if async transactions are enabled
 
@@ -18,8 +18,41 @@
 
 #include "SQLStorage.h"
 
+#include <cstdio>
+
+#define SQL_STORAGE_SNAPSHOT_MAGIC   0x534E5153             // 'SQNS'
+#define SQL_STORAGE_SNAPSHOT_VERSION 2
+
+struct SQLStorageSnapshotHeader
+{
+    uint32 magic;
+    uint32 version;
+    uint64 tableChecksum;
+    uint64 dataChecksum;                                    // checksum of everything following the header
+    uint32 keySize;
+    uint32 maxEntry;
+    uint32 recordCount;
+    uint32 recordSize;
+    uint32 stringSize;
+};
+
+// FNV-1a, only used to detect truncated or damaged snapshot files
+static uint64 SnapshotChecksum(char const* data, size_t size)
+{
+    uint64 hash = uint64(14695981039346656037ULL);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= uint8(data[i]);
+        hash *= uint64(1099511628211ULL);
+    }
+    return hash;
+}
+
 // -----------------------------------  SQLStorageBase  ---------------------------------------- //
 
+std::string SQLStorageBase::s_snapshotDirectory;
+std::string SQLStorageBase::s_snapshotRevision;
+
 SQLStorageBase::SQLStorageBase() :
     m_tableName(nullptr),
     m_entry_field(nullptr),
@@ -120,6 +153,205 @@ void SQLStorageBase::Free()
     m_recordCount = 0;
 }
 
+void SQLStorageBase::SetSnapshotSettings(std::string const& directory, std::string const& revision)
+{
+    s_snapshotDirectory = directory;
+    if (!s_snapshotDirectory.empty() && s_snapshotDirectory.back() != '/' && s_snapshotDirectory.back() != '\\')
+        s_snapshotDirectory += '/';
+    s_snapshotRevision = revision;
+}
+
+std::string SQLStorageBase::GetSnapshotFileName() const
+{
+    return s_snapshotDirectory + m_tableName + ".snapshot";
+}
+
+// everything besides table content that influences the loaded records
+std::string SQLStorageBase::GetSnapshotKey(std::string const& dependency) const
+{
+    return s_snapshotRevision + '|' + m_src_format + '|' + m_dst_format + '|' + dependency;
+}
+
+std::vector<uint32> SQLStorageBase::GetStringFieldOffsets() const
+{
+    std::vector<uint32> offsets;
+
+    uint32 offset = 0;
+    for (uint32 x = 0; x < m_dstFieldCount; ++x)
+    {
+        switch (m_dst_format[x])
+        {
+            case FT_LOGIC:
+                offset += sizeof(bool);
+                break;
+            case FT_STRING:
+                offsets.push_back(offset);
+                offset += sizeof(char*);
+                break;
+            case FT_NA:
+            case FT_INT:
+                offset += sizeof(uint32);
+                break;
+            case FT_BYTE:
+            case FT_NA_BYTE:
+                offset += sizeof(char);
+                break;
+            case FT_FLOAT:
+            case FT_NA_FLOAT:
+                offset += sizeof(float);
+                break;
+            case FT_NA_POINTER:
+                offset += sizeof(char*);
+                break;
+            case FT_64BITINT:
+                offset += sizeof(uint64);
+                break;
+            default:
+                break;
+        }
+    }
+
+    return offsets;
+}
+
+void SQLStorageBase::SaveSnapshot(uint64 tableChecksum, std::string const& dependency, std::vector<uint32> const& recordIds) const
+{
+    if (recordIds.size() != m_recordCount)
+        return;
+
+    std::string key = GetSnapshotKey(dependency);
+    std::vector<uint32> stringOffsets = GetStringFieldOffsets();
+
+    // records with string pointers replaced by (offset + 1) into the string block, 0 for nullptr
+    std::vector<char> records(m_data, m_data + size_t(m_recordCount) * m_recordSize);
+    std::string strings;
+    for (uint32 i = 0; i < m_recordCount; ++i)
+    {
+        char* record = &records[size_t(i) * m_recordSize];
+        for (uint32 offset : stringOffsets)
+        {
+            char const* str;
+            memcpy(&str, record + offset, sizeof(char*));
+
+            uint64 stored = 0;
+            if (str)
+            {
+                stored = strings.size() + 1;
+                strings.append(str, strlen(str) + 1);
+            }
+            memset(record + offset, 0, sizeof(char*));
+            memcpy(record + offset, &stored, std::min(sizeof(stored), sizeof(char*)));
+        }
+    }
+
+    std::vector<char> body;
+    body.reserve(key.size() + recordIds.size() * sizeof(uint32) + records.size() + strings.size());
+    body.insert(body.end(), key.begin(), key.end());
+    body.insert(body.end(), reinterpret_cast<char const*>(recordIds.data()), reinterpret_cast<char const*>(recordIds.data() + recordIds.size()));
+    body.insert(body.end(), records.begin(), records.end());
+    body.insert(body.end(), strings.begin(), strings.end());
+
+    SQLStorageSnapshotHeader header;
+    header.magic = SQL_STORAGE_SNAPSHOT_MAGIC;
+    header.version = SQL_STORAGE_SNAPSHOT_VERSION;
+    header.tableChecksum = tableChecksum;
+    header.dataChecksum = SnapshotChecksum(body.data(), body.size());
+    header.keySize = key.size();
+    header.maxEntry = m_maxEntry;
+    header.recordCount = m_recordCount;
+    header.recordSize = m_recordSize;
+    header.stringSize = strings.size();
+
+    // write to temporary file first, a crash while writing must not leave a half written snapshot behind
+    std::string fileName = GetSnapshotFileName();
+    std::string tempName = fileName + ".tmp";
+    FILE* f = fopen(tempName.c_str(), "wb");
+    if (!f)
+    {
+        sLog.outError("SQLStorage: could not create snapshot file %s", tempName.c_str());
+        return;
+    }
+
+    bool written = fwrite(&header, sizeof(header), 1, f) == 1 && (body.empty() || fwrite(body.data(), body.size(), 1, f) == 1);
+    fclose(f);
+
+    remove(fileName.c_str());
+    if (!written || rename(tempName.c_str(), fileName.c_str()) != 0)
+    {
+        sLog.outError("SQLStorage: could not write snapshot file %s", fileName.c_str());
+        remove(tempName.c_str());
+    }
+}
+
+bool SQLStorageBase::LoadSnapshot(uint64 tableChecksum, std::string const& dependency)
+{
+    FILE* f = fopen(GetSnapshotFileName().c_str(), "rb");
+    if (!f)
+        return false;
+
+    SQLStorageSnapshotHeader header;
+    if (fread(&header, sizeof(header), 1, f) != 1 || header.magic != SQL_STORAGE_SNAPSHOT_MAGIC ||
+            header.version != SQL_STORAGE_SNAPSHOT_VERSION || header.tableChecksum != tableChecksum)
+    {
+        fclose(f);
+        return false;
+    }
+
+    size_t bodySize = size_t(header.keySize) + size_t(header.recordCount) * (sizeof(uint32) + header.recordSize) + header.stringSize;
+    std::vector<char> body(bodySize);
+    bool read = bodySize == 0 || fread(body.data(), bodySize, 1, f) == 1;
+    fclose(f);
+
+    if (!read || SnapshotChecksum(body.data(), body.size()) != header.dataChecksum)
+    {
+        sLog.outError("SQLStorage: snapshot of %s is damaged, loading from database", m_tableName);
+        return false;
+    }
+
+    char const* ptr = body.data();
+    if (std::string(ptr, header.keySize) != GetSnapshotKey(dependency))
+        return false;
+    ptr += header.keySize;
+
+    uint32 const* recordIds = reinterpret_cast<uint32 const*>(ptr);
+    ptr += header.recordCount * sizeof(uint32);
+    char const* records = ptr;
+    ptr += size_t(header.recordCount) * header.recordSize;
+    char const* strings = ptr;
+
+    std::vector<uint32> stringOffsets = GetStringFieldOffsets();
+
+    prepareToLoad(header.maxEntry, header.recordCount, header.recordSize);
+    for (uint32 i = 0; i < header.recordCount; ++i)
+    {
+        uint32 recordId;
+        memcpy(&recordId, &recordIds[i], sizeof(uint32));
+
+        char* record = createRecord(recordId);
+        memcpy(record, records + size_t(i) * header.recordSize, header.recordSize);
+
+        // strings are owned by records, see Free()
+        for (uint32 offset : stringOffsets)
+        {
+            uint64 stored = 0;
+            memcpy(&stored, record + offset, std::min(sizeof(stored), sizeof(char*)));
+
+            char* str = nullptr;
+            if (stored && stored <= header.stringSize)
+            {
+                char const* src = strings + stored - 1;
+                size_t len = strnlen(src, header.stringSize - (stored - 1)) + 1;
+                str = new char[len];
+                memcpy(str, src, len - 1);
+                str[len - 1] = 0;
+            }
+            memcpy(record + offset, &str, sizeof(char*));
+        }
+    }
+
+    return true;
+}
+
 // -----------------------------------  SQLStorage  -------------------------------------------- //
 
 void SQLStorage::EraseEntry(uint32 id)
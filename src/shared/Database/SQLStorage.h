@@ -39,6 +39,10 @@ class SQLStorageBase
         uint32 GetMaxEntry() const { return m_maxEntry; };
         uint32 GetRecordCount() const { return m_recordCount; };
 
+        // binary snapshots of freshly loaded records, reused instead of SQL while table content and core revision match
+        static void SetSnapshotSettings(std::string const& directory, std::string const& revision);
+        static bool IsSnapshotEnabled() { return !s_snapshotDirectory.empty(); }
+
         template<typename T>
         class SQLSIterator
         {
@@ -78,9 +82,19 @@ class SQLStorageBase
         virtual void JustCreatedRecord(uint32 recordId, char* record) = 0;
         virtual void Free();
 
+        bool LoadSnapshot(uint64 tableChecksum, std::string const& dependency);
+        void SaveSnapshot(uint64 tableChecksum, std::string const& dependency, std::vector<uint32> const& recordIds) const;
+
     private:
         char* createRecord(uint32 recordId);
 
+        std::string GetSnapshotFileName() const;
+        std::string GetSnapshotKey(std::string const& dependency) const;
+        std::vector<uint32> GetStringFieldOffsets() const;
+
+        static std::string s_snapshotDirectory;
+        static std::string s_snapshotRevision;
+
         // Information about the table
         const char* m_tableName;
         const char* m_entry_field;
@@ -264,6 +278,9 @@ class SQLStorageLoaderBase
         void default_fill(uint32 field_pos, S src, D& dst);
         void default_fill_to_str(uint32 field_pos, char const* src, char*& dst);
 
+        // state outside of the table the conversions depend on, part of the snapshot key
+        std::string GetSnapshotDependency() const { return std::string(); }
+
         // trap, no body
         template<class D>
         void convert_from_str(uint32 field_pos, char* src, D& dst);
@@ -214,7 +214,32 @@ template<class DerivedLoader, class StorageClass>
 void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store, bool error_at_empty /*= true*/)
 {
     Field* fields = nullptr;
-    QueryResult* result  = WorldDatabase.PQuery("SELECT MAX(%s) FROM %s", store.EntryFieldName(), store.GetTableName());
+    QueryResult* result = nullptr;
+
+    // table content fingerprint computed by the sql server, snapshot is only valid as long as it does not change
+    uint64 tableChecksum = 0;
+    std::string dependency;
+#ifndef DO_POSTGRESQL
+    if (store.IsSnapshotEnabled())
+    {
+        dependency = static_cast<DerivedLoader*>(this)->GetSnapshotDependency();
+
+        result = WorldDatabase.PQuery("CHECKSUM TABLE %s", store.GetTableName());
+        if (result)
+        {
+            tableChecksum = (*result)[1].GetUInt64();
+            delete result;
+        }
+
+        if (tableChecksum && store.LoadSnapshot(tableChecksum, dependency))
+        {
+            sLog.outString("Loaded %u records of %s from snapshot", store.GetRecordCount(), store.GetTableName());
+            return;
+        }
+    }
+#endif
+
+    result = WorldDatabase.PQuery("SELECT MAX(%s) FROM %s", store.EntryFieldName(), store.GetTableName());
     if (!result)
     {
         sLog.outError("Error loading %s table (not exist?)\n", store.GetTableName());
@@ -296,6 +321,10 @@ void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store
     // Prepare data storage and lookup storage
     store.prepareToLoad(maxRecordId, recordCount, recordsize);
 
+    std::vector<uint32> recordIds;
+    if (tableChecksum)
+        recordIds.reserve(recordCount);
+
     BarGoLink bar(recordCount);
     do
     {
@@ -303,6 +332,8 @@ void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store
         bar.step();
 
         char* record = store.createRecord(fields[0].GetUInt32());
+        if (tableChecksum)
+            recordIds.push_back(fields[0].GetUInt32());
         offset = 0;
 
         // dependend on dest-size
@@ -353,6 +384,9 @@ void SQLStorageLoaderBase<DerivedLoader, StorageClass>::Load(StorageClass& store
     while (result->NextRow());
 
     delete result;
+
+    if (tableChecksum)
+        store.SaveSnapshot(tableChecksum, dependency, recordIds);
 }
 
 #endif
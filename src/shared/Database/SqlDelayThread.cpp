@@ -20,7 +20,7 @@
 #include "Database/SqlOperations.h"
 #include "DatabaseEnv.h"
 
-SqlDelayThread::SqlDelayThread(Database* db, SqlConnection* conn) : m_dbEngine(db), m_dbConnection(conn), m_running(true)
+SqlDelayThread::SqlDelayThread(Database* db, SqlConnection* conn) : m_dbEngine(db), m_dbConnection(conn), m_running(true), m_pendingCount(0)
 {
 }
 
@@ -82,5 +82,6 @@ void SqlDelayThread::ProcessRequests()
         auto const s = std::move(sqlQueue.front());
         sqlQueue.pop();
         s->Execute(m_dbConnection);
+        --m_pendingCount;
     }
 }
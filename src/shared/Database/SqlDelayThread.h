@@ -39,6 +39,7 @@ class SqlDelayThread : public MaNGOS::Runnable
         Database* m_dbEngine;                                   ///< Pointer to used Database engine
         SqlConnection* m_dbConnection;                          ///< Pointer to DB connection
         std::atomic<bool> m_running;
+        std::atomic<size_t> m_pendingCount;                     ///< Queued and not yet executed statements
 
         // process all enqueued requests
         void ProcessRequests();
@@ -52,9 +53,13 @@ class SqlDelayThread : public MaNGOS::Runnable
         {
             std::lock_guard<std::mutex> guard(m_queueMutex);
             m_sqlQueue.push(std::unique_ptr<SqlOperation>(sql));
+            ++m_pendingCount;
             return true;
         }
 
+        ///< Amount of statements waiting for execution
+        size_t GetQueueSize() const { return m_pendingCount; }
+
         virtual void Stop();                                ///< Stop event
         virtual void run();                                 ///< Main Thread loop
 };
@@ -0,0 +1,114 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "Database/SqlHolderPool.h"
+#include "Database/SqlOperations.h"
+#include "DatabaseEnv.h"
+#include "Timer.h"
+
+SqlHolderPool::SqlHolderPool(std::vector<SqlConnection*> const& connections) : m_stopping(false)
+{
+    for (SqlConnection* conn : connections)
+        m_workerThreads.push_back(std::thread(&SqlHolderPool::WorkerThread, this, conn));
+}
+
+SqlHolderPool::~SqlHolderPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queueLock);
+        m_stopping = true;
+    }
+    m_condition.notify_all();
+
+    for (auto& thread : m_workerThreads)
+        thread.join();
+}
+
+void SqlHolderPool::Dispatch(SqlQueryHolder* holder, MaNGOS::IQueryCallback* callback, SqlResultQueue* queue)
+{
+    std::shared_ptr<HolderExecution> execution = std::make_shared<HolderExecution>();
+    execution->holder = holder;
+    execution->callback = callback;
+    execution->queue = queue;
+    execution->startTime = WorldTimer::getMSTime();
+    holder->m_queueDelay = WorldTimer::getMSTimeDiff(holder->m_queuedTime, execution->startTime);
+
+    std::vector<size_t> indexes;
+    for (size_t i = 0; i < holder->m_queries.size(); ++i)
+        if (holder->m_queries[i].first)
+            indexes.push_back(i);
+
+    // set before any task is visible to workers
+    execution->pendingQueries = indexes.size();
+    if (indexes.empty())
+    {
+        Finish(*execution);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_queueLock);
+        for (size_t index : indexes)
+            m_tasks.push(QueryTask{ execution, index });
+    }
+    m_condition.notify_all();
+}
+
+void SqlHolderPool::Finish(HolderExecution& execution)
+{
+    execution.holder->m_executionTime = WorldTimer::getMSTimeDiff(execution.startTime, WorldTimer::getMSTime());
+    /// sync with the caller thread
+    execution.queue->Add(execution.callback);
+}
+
+void SqlHolderPool::WorkerThread(SqlConnection* conn)
+{
+#ifndef DO_POSTGRESQL
+    mysql_thread_init();
+#endif
+
+    while (true)
+    {
+        QueryTask task;
+        {
+            std::unique_lock<std::mutex> lock(m_queueLock);
+            while (m_tasks.empty() && !m_stopping)
+                m_condition.wait(lock);
+
+            // on stop only leave once every queued holder got its results
+            if (m_tasks.empty())
+                break;
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+
+        HolderExecution& execution = *task.execution;
+        {
+            SqlConnection::Lock guard(conn);
+            execution.holder->SetResult(task.index, conn->Query(execution.holder->m_queries[task.index].first));
+        }
+
+        if (--execution.pendingQueries == 0)
+            Finish(execution);
+    }
+
+#ifndef DO_POSTGRESQL
+    mysql_thread_end();
+#endif
+}
@@ -0,0 +1,80 @@
+/*
+ * This file is part of the CMaNGOS Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef __SQLHOLDERPOOL_H
+#define __SQLHOLDERPOOL_H
+
+#include "Common.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+class SqlConnection;
+class SqlQueryHolder;
+class SqlResultQueue;
+
+namespace MaNGOS
+{
+    class IQueryCallback;
+}
+
+/// Executes the queries of a SqlQueryHolder in parallel, one worker thread per query connection.
+/// The holder callback is queued once the last query of the holder returned.
+class SqlHolderPool
+{
+    public:
+        explicit SqlHolderPool(std::vector<SqlConnection*> const& connections);
+        ~SqlHolderPool();                                   ///< finishes all queued holders before returning
+
+        SqlHolderPool(SqlHolderPool const&) = delete;
+        SqlHolderPool& operator=(SqlHolderPool const&) = delete;
+
+        void Dispatch(SqlQueryHolder* holder, MaNGOS::IQueryCallback* callback, SqlResultQueue* queue);
+
+    private:
+        struct HolderExecution
+        {
+            SqlQueryHolder* holder;
+            MaNGOS::IQueryCallback* callback;
+            SqlResultQueue* queue;
+            uint32 startTime;
+            std::atomic<size_t> pendingQueries;
+        };
+
+        struct QueryTask
+        {
+            std::shared_ptr<HolderExecution> execution;
+            size_t index;
+        };
+
+        void WorkerThread(SqlConnection* conn);
+        static void Finish(HolderExecution& execution);
+
+        std::mutex m_queueLock;
+        std::condition_variable m_condition;
+        std::queue<QueryTask> m_tasks;
+        bool m_stopping;
+
+        std::vector<std::thread> m_workerThreads;
+};
+#endif                                                      //__SQLHOLDERPOOL_H
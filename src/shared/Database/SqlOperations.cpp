@@ -20,6 +20,8 @@
 #include "SqlDelayThread.h"
 #include "DatabaseEnv.h"
 #include "DatabaseImpl.h"
+#include "SqlHolderPool.h"
+#include "Timer.h"
 
 #include <cstdarg>
 
@@ -117,11 +119,20 @@ void SqlResultQueue::Add(MaNGOS::IQueryCallback* callback)
     m_queue.push(std::unique_ptr<MaNGOS::IQueryCallback>(callback));
 }
 
-bool SqlQueryHolder::Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* thread, SqlResultQueue* queue)
+bool SqlQueryHolder::Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* thread, SqlResultQueue* queue, SqlHolderPool* pool /*= nullptr*/)
 {
     if (!callback || !thread || !queue)
         return false;
 
+    m_queuedTime = WorldTimer::getMSTime();
+
+    /// with a holder pool the delay thread only hands the holder over, queries run in parallel on the query connections
+    if (pool)
+    {
+        thread->Delay(new SqlQueryHolderDispatch(this, callback, queue, pool));
+        return true;
+    }
+
     /// delay the execution of the queries, sync them with the delay thread
     /// which will in turn resync on execution (via the queue) and call back
     SqlQueryHolderEx* holderEx = new SqlQueryHolderEx(this, callback, queue);
@@ -221,6 +232,9 @@ bool SqlQueryHolderEx::Execute(SqlConnection* conn)
         return false;
 
     LOCK_DB_CONN(conn);
+    uint32 startTime = WorldTimer::getMSTime();
+    m_holder->m_queueDelay = WorldTimer::getMSTimeDiff(m_holder->m_queuedTime, startTime);
+
     /// we can do this, we are friends
     std::vector<SqlQueryHolder::SqlResultPair>& queries = m_holder->m_queries;
     for (size_t i = 0; i < queries.size(); ++i)
@@ -230,8 +244,19 @@ bool SqlQueryHolderEx::Execute(SqlConnection* conn)
         if (sql) m_holder->SetResult(i, conn->Query(sql));
     }
 
+    m_holder->m_executionTime = WorldTimer::getMSTimeDiff(startTime, WorldTimer::getMSTime());
+
     /// sync with the caller thread
     m_queue->Add(m_callback);
 
     return true;
 }
+
+bool SqlQueryHolderDispatch::Execute(SqlConnection* /*conn*/)
+{
+    if (!m_holder || !m_callback || !m_queue || !m_pool)
+        return false;
+
+    m_pool->Dispatch(m_holder, m_callback, m_queue);
+    return true;
+}
@@ -87,6 +87,7 @@ class SqlQuery;                                             /// contains a singl
 class QueryResult;                                          /// the result of one
 class SqlQueryHolder;                                       /// groups several async quries
 class SqlQueryHolderEx;                                     /// points to a holder, added to the delay thread
+class SqlHolderPool;                                        /// executes holder queries in parallel
 
 class SqlResultQueue
 {
@@ -119,18 +120,25 @@ class SqlQuery : public SqlOperation
 class SqlQueryHolder
 {
         friend class SqlQueryHolderEx;
+        friend class SqlHolderPool;
     private:
         typedef std::pair<const char*, QueryResult*> SqlResultPair;
         std::vector<SqlResultPair> m_queries;
+        uint32 m_queuedTime;                                // when Execute was called
+        uint32 m_queueDelay;                                // time waiting for previously queued async requests
+        uint32 m_executionTime;                             // time from first query start to last result
     public:
-        SqlQueryHolder() {}
+        SqlQueryHolder() : m_queuedTime(0), m_queueDelay(0), m_executionTime(0) {}
         ~SqlQueryHolder();
         bool SetQuery(size_t index, const char* sql);
         bool SetPQuery(size_t index, const char* format, ...) ATTR_PRINTF(3, 4);
         void SetSize(size_t size);
         QueryResult* GetResult(size_t index);
         void SetResult(size_t index, QueryResult* result);
-        bool Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* thread, SqlResultQueue* queue);
+        bool Execute(MaNGOS::IQueryCallback* callback, SqlDelayThread* thread, SqlResultQueue* queue, SqlHolderPool* pool = nullptr);
+
+        uint32 GetQueueDelay() const { return m_queueDelay; }
+        uint32 GetExecutionTime() const { return m_executionTime; }
 };
 
 class SqlQueryHolderEx : public SqlOperation
@@ -144,4 +152,18 @@ class SqlQueryHolderEx : public SqlOperation
             : m_holder(holder), m_callback(callback), m_queue(queue) {}
         bool Execute(SqlConnection* conn) override;
 };
+
+/// added to the delay thread so the holder only reads after async requests queued before it, then fans out its queries
+class SqlQueryHolderDispatch : public SqlOperation
+{
+    private:
+        SqlQueryHolder* m_holder;
+        MaNGOS::IQueryCallback* m_callback;
+        SqlResultQueue* m_queue;
+        SqlHolderPool* m_pool;
+    public:
+        SqlQueryHolderDispatch(SqlQueryHolder* holder, MaNGOS::IQueryCallback* callback, SqlResultQueue* queue, SqlHolderPool* pool)
+            : m_holder(holder), m_callback(callback), m_queue(queue), m_pool(pool) {}
+        bool Execute(SqlConnection* conn) override;
+};
 #endif                                                      //__SQLOPERATIONS_H
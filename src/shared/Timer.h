@@ -161,4 +161,17 @@ struct ShortTimeTracker
         uint32 i_expiryTime;
 };
 
+// time slice for resumable jobs, budget 0 means unlimited
+struct TimeBudget
+{
+    public:
+        explicit TimeBudget(uint32 budget) : i_startTime(WorldTimer::getMSTime()), i_budget(budget) {}
+        bool Exceeded() const { return i_budget && GetElapsed() >= i_budget; }
+        uint32 GetElapsed() const { return WorldTimer::getMSTimeDiff(i_startTime, WorldTimer::getMSTime()); }
+
+    private:
+        uint32 i_startTime;
+        uint32 i_budget;
+};
+
 #endif
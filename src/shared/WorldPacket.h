@@ -22,11 +22,12 @@
 #include "Common.h"
 #include "ByteBuffer.h"
 #include "Server/Opcodes.h"
+#include "Utilities/ObjectPool.h"
 #include <chrono>
 
 // Note: m_opcode and size stored in platfom dependent format
 // ignore endianess until send, and converted at receive
-class WorldPacket : public ByteBuffer
+class WorldPacket : public ByteBuffer, public MaNGOS::PooledObject<WorldPacket>
 {
     public:
         // just container for later use
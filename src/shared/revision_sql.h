@@ -1,6 +1,6 @@
 #ifndef __REVISION_SQL_H__
 #define __REVISION_SQL_H__
  #define REVISION_DB_REALMD "required_s2421_01_realmd_account_locale_agnostic"
- #define REVISION_DB_CHARACTERS "required_s2420_01_characters_item_instance_data_drop"
+ #define REVISION_DB_CHARACTERS "required_s2423_01_characters_mail_expire_time_index"
  #define REVISION_DB_MANGOS "required_s2422_01_mangos_creature_template_spells_extension"
 #endif // __REVISION_SQL_H__